@@ -9,6 +9,8 @@
 #include "RiveArtboard.h"
 #include "Logs/RiveLog.h"
 #include "Rive/RiveFile.h"
+#include "Rive/RiveTickSubsystem.h"
+#include "Stats/RiveStats.h"
 
 namespace UE::Rive::Core
 {
@@ -17,38 +19,92 @@ namespace UE::Rive::Core
 
 URiveActorComponent::URiveActorComponent(): Size(500, 500)
 {
-    // Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-    // off to improve performance if you don't need them.
-    PrimaryComponentTick.bCanEverTick = true;
+    // The Artboards are ticked by the URiveTickSubsystem, which advances them along all the other Rive Artboards. See GetRiveTickWorld for pause and time dilation
+    PrimaryComponentTick.bCanEverTick = false;
 }
 
 void URiveActorComponent::BeginPlay()
 {
     InitializeRenderTarget(Size.X, Size.Y);
+    URiveTickSubsystem::RegisterTickable(this);
     Super::BeginPlay();
 }
 
-void URiveActorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void URiveActorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    URiveTickSubsystem::UnregisterTickable(this);
+    Super::EndPlay(EndPlayReason);
+}
+
+bool URiveActorComponent::IsRiveTickable() const
+{
+    return IsValidChecked(this) && RiveRenderTarget.IsValid();
+}
+
+void URiveActorComponent::GetRiveTickArtboards(TArray<URiveArtboard*>& OutArtboards) const
+{
+    OutArtboards.Append(RenderObjects);
+}
+
+TOptional<double> URiveActorComponent::GetRiveLastDisplayTime() const
+{
+    if (!bSuspendWhenOffscreen || !RenderTarget)
+    {
+        return {};
+    }
 
-    if (!IsValidChecked(this))
+    return RenderTarget->GetLastDisplayTime();
+}
+
+bool URiveActorComponent::HasPendingRiveUpdate() const
+{
+    if (RiveRenderTarget && RiveRenderTarget->NeedsRedraw())
+    {
+        return true;
+    }
+
+    for (const URiveArtboard* Artboard : RenderObjects)
+    {
+        if (IsValid(Artboard) && Artboard->IsInitialized() && (Artboard->HasPendingStateMachineChanges() || Artboard->NeedsRedraw()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void URiveActorComponent::RiveTick_Render(float InDeltaSeconds)
+{
+    if (!RiveRenderTarget)
     {
         return;
     }
 
-    if (RiveRenderTarget)
+    // All the Artboards share the Render Target, so they are all redrawn as soon as any of them changed
+    bool bNeedsRedraw = RiveRenderTarget->NeedsRedraw();
+    for (const URiveArtboard* Artboard : RenderObjects)
     {
-        for (URiveArtboard* Artboard : RenderObjects)
+        bNeedsRedraw |= IsValid(Artboard) && Artboard->IsInitialized() && Artboard->NeedsRedraw();
+    }
+
+    if (!bNeedsRedraw)
+    {
+        INC_DWORD_STAT(STAT_RiveSkippedRedraws);
+        return;
+    }
+
+    for (URiveArtboard* Artboard : RenderObjects)
+    {
+        if (IsValid(Artboard) && Artboard->IsInitialized())
         {
             RiveRenderTarget->Save();
-            Artboard->Tick(DeltaTime);
+            Artboard->Tick_Render(InDeltaSeconds);
             RiveRenderTarget->Restore();
         }
-
-
-        RiveRenderTarget->SubmitAndClear();
     }
+
+    RiveRenderTarget->SubmitAndClear();
 }
 
 void URiveActorComponent::InitializeRenderTarget(int32 SizeX, int32 SizeY)
@@ -1,6 +1,8 @@
 // Copyright Rive, Inc. All rights reserved.
 
 #include "Rive/RiveFile.h"
+#include "Rive/RiveTickSubsystem.h"
+#include "RiveTextureAtlas.h"
 #include "IRiveRenderTarget.h"
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
@@ -11,10 +13,13 @@
 #include "RiveCore/Public/Assets/URAssetImporter.h"
 #include "RiveCore/Public/Assets/URFileAssetLoader.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "EditorFramework/AssetImportData.h"
 #include "Misc/Paths.h"
 #include "Async/Async.h"
 #include "RenderingThread.h"
+#include "Stats/RiveStats.h"
+#include "Tasks/Task.h"
 
 #if WITH_RIVE
 #include "PreRiveHeaders.h"
@@ -23,6 +28,13 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 
+static TAutoConsoleVariable<bool> CVarRiveFileAsyncImport(
+	TEXT("Rive.File.AsyncImport"),
+	true,
+	TEXT("If true, the Rive Files already imported in the project are loaded and their assets decoded on worker threads, only the Artboard being instanced on the Game Thread.\n")
+	TEXT("The first import of a file in the editor stays synchronous, as it creates its Rive Assets."),
+	ECVF_Default);
+
 URiveFile::URiveFile()
 {
 	ArtboardIndex = 0;
@@ -31,7 +43,10 @@ URiveFile::URiveFile()
 void URiveFile::BeginDestroy()
 {
 	InitState = ERiveInitState::Deinitializing;
+
+	URiveTickSubsystem::UnregisterTickable(this);
 	
+	ReleaseAtlasEntry();
 	RiveRenderTarget.Reset();
 	
 	if (IsValid(Artboard))
@@ -45,33 +60,63 @@ void URiveFile::BeginDestroy()
 	Super::BeginDestroy();
 }
 
-TStatId URiveFile::GetStatId() const
+bool URiveFile::IsRiveTickable() const
 {
-	RETURN_QUICK_DECLARE_CYCLE_STAT(URiveFile, STATGROUP_Tickables);
+	return IsValidChecked(this) && !HasAnyFlags(RF_ClassDefaultObject) && bIsRendering && IsInitialized() && GetArtboard() && RiveRenderTarget;
 }
 
-void URiveFile::Tick(float InDeltaSeconds)
+void URiveFile::GetRiveTickArtboards(TArray<URiveArtboard*>& OutArtboards) const
 {
-	if (!IsValidChecked(this))
-	{
-		return;
-	}
+	OutArtboards.Add(Artboard);
+}
 
+void URiveFile::RiveTick_Render(float InDeltaSeconds)
+{
 #if WITH_RIVE
-	if (IsInitialized() && bIsRendering)
+	if (GetArtboard())
 	{
-		if (GetArtboard())
+		// Nothing changed since the last submission, the texture still holds the right content
+		if (!Artboard->NeedsRedraw() && !RiveRenderTarget->NeedsRedraw())
 		{
-			Artboard->Tick(InDeltaSeconds);
-			RiveRenderTarget->SubmitAndClear();
+			INC_DWORD_STAT(STAT_RiveSkippedRedraws);
+			return;
+		}
+		
+		// The default draw is not bound to OnArtboardTick_Render, otherwise the Artboard would consider its draw overridden and never skip it
+		if (Artboard->OnArtboardTick_Render.IsBound())
+		{
+			Artboard->Tick_Render(InDeltaSeconds);
+		}
+		else
+		{
+			OnArtboardTickRender(InDeltaSeconds, Artboard);
+		}
+		RiveRenderTarget->SubmitAndClear();
+
+		if (AtlasEntryHandle != INDEX_NONE)
+		{
+			if (URiveTextureAtlas* TextureAtlas = URiveTickSubsystem::GetTextureAtlas())
+			{
+				TextureAtlas->MarkEntryDirty(AtlasEntryHandle);
+			}
 		}
 	}
 #endif // WITH_RIVE
 }
 
-bool URiveFile::IsTickable() const
+bool URiveFile::HasPendingRiveUpdate() const
+{
+	return (Artboard && (Artboard->HasPendingStateMachineChanges() || Artboard->NeedsRedraw())) || (RiveRenderTarget && RiveRenderTarget->NeedsRedraw());
+}
+
+TOptional<double> URiveFile::GetRiveLastDisplayTime() const
 {
-	return !HasAnyFlags(RF_ClassDefaultObject) && bIsRendering;
+	if (!bSuspendWhenOffscreen)
+	{
+		return {};
+	}
+
+	return GetLastDisplayTime();
 }
 
 void URiveFile::PostLoad()
@@ -135,7 +180,8 @@ void URiveFile::PostLoad()
 		});
 	}
 	
-	if (!IsRunningCommandlet())
+	// The Null Renderer lets the other commandlets run the Rive Files, but cooking has no use for them
+	if (!IsRunningCookCommandlet())
 	{
 		UE::Rive::Renderer::IRiveRendererModule::Get().CallOrRegister_OnRendererInitialized(FSimpleMulticastDelegate::FDelegate::CreateUObject(this, &URiveFile::Initialize));
 	}
@@ -154,9 +200,21 @@ void URiveFile::PostEditChangeChainProperty(struct FPropertyChangedChainEvent& P
 	{
 		InstantiateArtboard();
 	}
+	else if (PropertyName == GET_MEMBER_NAME_CHECKED(URiveFile, bUseTextureAtlas) || PropertyName == GET_MEMBER_NAME_CHECKED(URiveFile, bCopyFromTextureAtlas))
+	{
+		InstantiateArtboard();
+	}
 	else if (ActiveMemberNodeName == GET_MEMBER_NAME_CHECKED(URiveFile, Size))
 	{
-		ResizeRenderTargets(Size);
+		if (IsInTextureAtlas())
+		{
+			// The atlas entries have a fixed size, so a new one is allocated
+			InstantiateArtboard();
+		}
+		else
+		{
+			ResizeRenderTargets(Size);
+		}
 	}
 	else if (ActiveMemberNodeName == GET_MEMBER_NAME_CHECKED(URiveFile, ClearColor))
 	{
@@ -172,11 +230,33 @@ void URiveFile::PostEditChangeChainProperty(struct FPropertyChangedChainEvent& P
 		RiveRenderTarget->Initialize();
 	}
 
+	// Fit type, alignment and the like only change how the Artboard is drawn, a settled Artboard would otherwise keep its stale output
+	if (Artboard)
+	{
+		Artboard->RequestRedraw();
+	}
+
 	FlushRenderingCommands();
 }
 
 #endif // WITH_EDITOR
 
+URiveTexture* URiveFile::GetDisplayTexture(FBox2f& OutUVRect) const
+{
+	if (AtlasEntryHandle != INDEX_NONE)
+	{
+		if (const URiveTextureAtlas* TextureAtlas = URiveTickSubsystem::GetTextureAtlas())
+		{
+			if (URiveTexture* PageTexture = TextureAtlas->GetEntryTexture(AtlasEntryHandle, OutUVRect))
+			{
+				return PageTexture;
+			}
+		}
+	}
+
+	return Super::GetDisplayTexture(OutUVRect);
+}
+
 URiveFile* URiveFile::CreateInstance(const FString& InArtboardName, const FString& InStateMachineName)
 {
 	auto NewRiveFileInstance = NewObject<
@@ -185,6 +265,11 @@ URiveFile* URiveFile::CreateInstance(const FString& InArtboardName, const FStrin
 	NewRiveFileInstance->ArtboardName = InArtboardName.IsEmpty() ? ArtboardName : InArtboardName;
 	NewRiveFileInstance->StateMachineName = InStateMachineName.IsEmpty() ? StateMachineName : InStateMachineName;
 	NewRiveFileInstance->ArtboardIndex = ArtboardIndex;
+	NewRiveFileInstance->bUseTextureAtlas = bUseTextureAtlas;
+	NewRiveFileInstance->bCopyFromTextureAtlas = bCopyFromTextureAtlas;
+	NewRiveFileInstance->UpdateRate = UpdateRate;
+	NewRiveFileInstance->bTimeSliced = bTimeSliced;
+	NewRiveFileInstance->bSuspendWhenOffscreen = bSuspendWhenOffscreen;
 	NewRiveFileInstance->PostLoad();
 	return NewRiveFileInstance;
 }
@@ -377,76 +462,158 @@ void URiveFile::Initialize()
 	RiveRenderer->CallOrRegister_OnInitialized(UE::Rive::Renderer::IRiveRenderer::FOnRendererInitialized::FDelegate::CreateLambda(
 	[this](UE::Rive::Renderer::IRiveRenderer* RiveRenderer)
 	{
-		rive::pls::PLSRenderContext* PLSRenderContext;
+		// Paths and Paints are created by the renderer factory so the Artboards can be snapshotted for the Render Thread.
+		// There is no PLSRenderContext with the Null Renderer, the factory then creates no image nor buffer
+		rive::Factory* RiveFactory = RiveRenderer->GetFactory();
+		
+		if (!ensure(RiveFactory))
 		{
-			FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-			PLSRenderContext = RiveRenderer->GetPLSRenderContextPtr();
+			UE_LOG(LogRive, Error, TEXT("Failed to import rive file."));
+			BroadcastInitializationResult(false);
+			return;
 		}
-		
-		if (ensure(PLSRenderContext))
+
+		if (ParentRiveFile)
 		{
-			ArtboardNames.Empty();
+			FinishInitialization();
+			return;
+		}
 
-			if (!ParentRiveFile)
-			{
-				FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-				rive::ImportResult ImportResult;
-				if (bNeedsImport)
-				{
-					bNeedsImport = false;
-					const TUniquePtr<UE::Rive::Assets::FURAssetImporter> AssetImporter = MakeUnique<UE::Rive::Assets::FURAssetImporter>(GetOutermost(), RiveFilePath, GetAssets());
-					RiveNativeFilePtr = rive::File::import(RiveNativeFileSpan, PLSRenderContext, &ImportResult, AssetImporter.Get());
-					if (ImportResult != rive::ImportResult::success)
-					{
-						UE_LOG(LogRive, Error, TEXT("Failed to import rive file."));
-						Lock.Unlock();
-						BroadcastInitializationResult(false);
-						return;
-					}
-				}
-				
-				const TUniquePtr<UE::Rive::Assets::FURFileAssetLoader> FileAssetLoader = MakeUnique<UE::Rive::Assets::FURFileAssetLoader>(this, GetAssets());
-				RiveNativeFilePtr = rive::File::import(RiveNativeFileSpan, PLSRenderContext, &ImportResult, FileAssetLoader.Get());
+		// Importing a new file creates its URiveAssets, which can only be done on the Game Thread
+		if (!bNeedsImport && CVarRiveFileAsyncImport.GetValueOnGameThread())
+		{
+			ImportNativeFileAsync(RiveFactory);
+			return;
+		}
 
-				if (ImportResult != rive::ImportResult::success)
-				{
-					UE_LOG(LogRive, Error, TEXT("Failed to load rive file."));
-					Lock.Unlock();
-					BroadcastInitializationResult(false);
-					return;
-				}
-				
-				// UI Helper
-				for (int i = 0; i < RiveNativeFilePtr->artboardCount(); ++i)
-				{
-					rive::Artboard* NativeArtboard = RiveNativeFilePtr->artboard(i);
-					ArtboardNames.Add(NativeArtboard->name().c_str());
-				}
+		// A new file gets its assets imported by the same traversal which loads them
+		TUniquePtr<UE::Rive::Assets::FURAssetImporter> AssetImporter;
+		if (bNeedsImport)
+		{
+			bNeedsImport = false;
+			AssetImporter = MakeUnique<UE::Rive::Assets::FURAssetImporter>(GetOutermost(), RiveFilePath, GetAssets());
+		}
+		
+		std::unique_ptr<rive::File> NativeFile;
+		{
+			SCOPE_CYCLE_COUNTER(STAT_RiveFileImport);
+			rive::ImportResult ImportResult;
+			const TUniquePtr<UE::Rive::Assets::FURFileAssetLoader> FileAssetLoader = MakeUnique<UE::Rive::Assets::FURFileAssetLoader>(this, GetAssets(), AssetImporter.Get());
+			NativeFile = rive::File::import(RiveNativeFileSpan, RiveFactory, &ImportResult, FileAssetLoader.Get());
+			if (ImportResult == rive::ImportResult::success)
+			{
+				FileAssetLoader->DecodeGatheredAssets();
+				FileAssetLoader->PublishDecodedAssets();
 			}
-			else if (ensure(IsValid(ParentRiveFile)))
+			else
 			{
-				ArtboardNames = ParentRiveFile->ArtboardNames;
+				NativeFile.reset();
 			}
-			
-			InstantiateArtboard(false); // We want the ArtboardChanged event to be raised after the Initialization Result
-			if (ensure(GetArtboard()))
+		}
+		OnNativeFileImported(MoveTemp(NativeFile));
+	}));
+#endif // WITH_RIVE
+}
+
+#if WITH_RIVE
+
+void URiveFile::ImportNativeFileAsync(rive::Factory* InRiveFactory)
+{
+	check(IsInGameThread());
+
+	// The task owns copies of the file and asset bytes, a reimport may free RiveFileData and the URiveAssets meanwhile.
+	// It reads no UObject, the decoded assets are only handed to their URiveAsset back on the Game Thread
+	TUniquePtr<UE::Rive::Assets::FURFileAssetLoader> FileAssetLoader = MakeUnique<UE::Rive::Assets::FURFileAssetLoader>(this, GetAssets());
+	FileAssetLoader->CopyAssetBytes();
+	TArray<uint8> FileBytes(RiveNativeFileSpan.data(), static_cast<int32>(RiveNativeFileSpan.size()));
+	
+	UE::Tasks::Launch(UE_SOURCE_LOCATION,
+	[WeakThis = TWeakObjectPtr<URiveFile>(this), RiveFactory = InRiveFactory, FileAssetLoader = MoveTemp(FileAssetLoader), FileBytes = MoveTemp(FileBytes)]() mutable
+	{
+		std::unique_ptr<rive::File> NativeFile;
+		{
+			SCOPE_CYCLE_COUNTER(STAT_RiveFileImport);
+			rive::ImportResult ImportResult;
+			NativeFile = rive::File::import(rive::make_span(FileBytes.GetData(), FileBytes.Num()), RiveFactory, &ImportResult, FileAssetLoader.Get());
+			if (ImportResult == rive::ImportResult::success)
 			{
-				BroadcastInitializationResult(true);
+				FileAssetLoader->DecodeGatheredAssets();
 			}
 			else
 			{
-				UE_LOG(LogRive, Error, TEXT("Failed to instantiate the Artboard after importing the rive file."));
-				BroadcastInitializationResult(false);
+				NativeFile.reset();
 			}
-			OnArtboardChangedRaw.Broadcast(this, Artboard);
-			OnArtboardChanged.Broadcast(this, Artboard); // Now we can broadcast the Artboard Changed Event
-			return;
 		}
+		
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, FileAssetLoader = MoveTemp(FileAssetLoader), NativeFile = MoveTemp(NativeFile)]() mutable
+		{
+			// The loader references the assets of the file, it is only used if the file is still alive
+			if (URiveFile* RiveFile = WeakThis.Get())
+			{
+				if (NativeFile && RiveFile->InitState == ERiveInitState::Initializing)
+				{
+					FileAssetLoader->PublishDecodedAssets();
+				}
+				RiveFile->OnNativeFileImported(MoveTemp(NativeFile));
+			}
+		});
+	});
+}
 
-		UE_LOG(LogRive, Error, TEXT("Failed to import rive file."));
+void URiveFile::OnNativeFileImported(std::unique_ptr<rive::File>&& InNativeFile)
+{
+	check(IsInGameThread());
+
+	if (InitState != ERiveInitState::Initializing)
+	{
+		return;
+	}
+	
+	RiveNativeFilePtr = MoveTemp(InNativeFile);
+	if (!RiveNativeFilePtr)
+	{
+		UE_LOG(LogRive, Error, TEXT("Failed to load rive file."));
 		BroadcastInitializationResult(false);
-	}));
+		return;
+	}
+	
+	FinishInitialization();
+}
+
 #endif // WITH_RIVE
+
+void URiveFile::FinishInitialization()
+{
+	ArtboardNames.Empty();
+	
+	if (!ParentRiveFile)
+	{
+#if WITH_RIVE
+		// UI Helper
+		for (int i = 0; i < RiveNativeFilePtr->artboardCount(); ++i)
+		{
+			rive::Artboard* NativeArtboard = RiveNativeFilePtr->artboard(i);
+			ArtboardNames.Add(NativeArtboard->name().c_str());
+		}
+#endif // WITH_RIVE
+	}
+	else if (ensure(IsValid(ParentRiveFile)))
+	{
+		ArtboardNames = ParentRiveFile->ArtboardNames;
+	}
+	
+	InstantiateArtboard(false); // We want the ArtboardChanged event to be raised after the Initialization Result
+	if (ensure(GetArtboard()))
+	{
+		BroadcastInitializationResult(true);
+	}
+	else
+	{
+		UE_LOG(LogRive, Error, TEXT("Failed to instantiate the Artboard after importing the rive file."));
+		BroadcastInitializationResult(false);
+	}
+	OnArtboardChangedRaw.Broadcast(this, Artboard);
+	OnArtboardChanged.Broadcast(this, Artboard); // Now we can broadcast the Artboard Changed Event
 }
 
 void URiveFile::WhenInitialized(FOnRiveFileInitialized::FDelegate&& Delegate)
@@ -507,29 +674,63 @@ void URiveFile::InstantiateArtboard(bool bRaiseArtboardChangedEvent)
 	
 	Artboard = NewObject<URiveArtboard>(this);
 	
+	// The Render Target is only created once the Artboard size is known, as it decides whether we fit in the texture atlas
+	if (ArtboardName.IsEmpty())
+	{
+		Artboard->Initialize(GetNativeFile(), nullptr, ArtboardIndex, StateMachineName);
+	}
+	else
+	{
+		Artboard->Initialize(GetNativeFile(), nullptr, ArtboardName, StateMachineName);
+	}
+
+	Artboard->OnGetLocalCoordinate.BindDynamic(this, &URiveFile::GetLocalCoordinate);
+
+	const FIntPoint ArtboardSize(Artboard->GetSize().X, Artboard->GetSize().Y);
+	const FIntPoint TargetSize = bManualSize ? Size : FIntPoint(
+		FMath::Clamp(ArtboardSize.X, RIVE_MIN_TEX_RESOLUTION + 1, RIVE_MAX_TEX_RESOLUTION - 1),
+		FMath::Clamp(ArtboardSize.Y, RIVE_MIN_TEX_RESOLUTION + 1, RIVE_MAX_TEX_RESOLUTION - 1));
+
+	ReleaseAtlasEntry();
 	RiveRenderTarget.Reset();
-	RiveRenderTarget = RiveRenderer->CreateTextureTarget_GameThread(GetFName(), this);
-	if(!OnResourceInitializedOnRenderThread.IsBoundToObject(this))
+	if (bUseTextureAtlas && RiveRenderer->IsRendering())
 	{
-		OnResourceInitializedOnRenderThread.AddUObject(this, &URiveFile::OnResourceInitialized_RenderThread);
+		if (URiveTextureAtlas* TextureAtlas = URiveTickSubsystem::GetTextureAtlas())
+		{
+			AtlasEntryHandle = TextureAtlas->AddEntry(GetFName(), TargetSize, bCopyFromTextureAtlas ? this : nullptr, RiveRenderTarget);
+		}
 	}
-	RiveRenderTarget->SetClearColor(ClearColor);
 	
-	if (ArtboardName.IsEmpty())
+	if (!RiveRenderTarget)
 	{
-		Artboard->Initialize(GetNativeFile(), RiveRenderTarget, ArtboardIndex, StateMachineName);
+		RiveRenderTarget = RiveRenderer->CreateTextureTarget_GameThread(GetFName(), this);
+		if(!OnResourceInitializedOnRenderThread.IsBoundToObject(this))
+		{
+			OnResourceInitializedOnRenderThread.AddUObject(this, &URiveFile::OnResourceInitialized_RenderThread);
+		}
 	}
 	else
 	{
-		Artboard->Initialize(GetNativeFile(), RiveRenderTarget, ArtboardName, StateMachineName);
+		// The atlas entry target draws in its page, it must not be redirected to our own texture
+		OnResourceInitializedOnRenderThread.RemoveAll(this);
 	}
+	RiveRenderTarget->SetClearColor(ClearColor);
+	Artboard->SetRenderTarget(RiveRenderTarget);
 
-	Artboard->OnArtboardTick_Render.BindDynamic(this, &URiveFile::OnArtboardTickRender);
-	Artboard->OnGetLocalCoordinate.BindDynamic(this, &URiveFile::GetLocalCoordinate);
-
-	ResizeRenderTargets(bManualSize ? Size : Artboard->GetSize());
+	if (!RiveRenderer->IsRendering() || (IsInTextureAtlas() && !bCopyFromTextureAtlas))
+	{
+		// Nothing is drawn into the texture without rendering, nor when only displayed through the atlas page,
+		// Size is still what the input coordinates are mapped to
+		ReleaseRenderTargets(TargetSize);
+	}
+	else
+	{
+		ResizeRenderTargets(TargetSize);
+	}
 	RiveRenderTarget->Initialize();
 
+	URiveTickSubsystem::RegisterTickable(this);
+
 	PrintStats();
 	
 	if (bRaiseArtboardChangedEvent)
@@ -539,6 +740,29 @@ void URiveFile::InstantiateArtboard(bool bRaiseArtboardChangedEvent)
 	}
 }
 
+void URiveFile::ReleaseAtlasEntry()
+{
+	if (AtlasEntryHandle == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (URiveTextureAtlas* TextureAtlas = URiveTickSubsystem::GetTextureAtlas())
+	{
+		TextureAtlas->RemoveEntry(AtlasEntryHandle);
+	}
+	AtlasEntryHandle = INDEX_NONE;
+}
+
+void URiveFile::OnRenderResourcesChanged()
+{
+	// The new texture is blank until the Artboard draws again
+	if (Artboard)
+	{
+		Artboard->RequestRedraw();
+	}
+}
+
 void URiveFile::OnResourceInitialized_RenderThread(FRHICommandListImmediate& RHICmdList, FTextureRHIRef& NewResource) const
 {
 	// When the resource change, we need to tell the Render Target otherwise we will keep on drawing on an outdated RT
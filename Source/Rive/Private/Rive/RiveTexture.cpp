@@ -6,8 +6,10 @@
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
+#include "Materials/MaterialInstanceDynamic.h"
 #include "RenderingThread.h"
 #include "RiveArtboard.h"
+#include "RiveTexturePool.h"
 #include "RiveTextureResource.h"
 
 URiveTexture::URiveTexture()
@@ -25,19 +27,17 @@ URiveTexture::URiveTexture()
 
 FTextureResource* URiveTexture::CreateResource()
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (!RiveRenderer)
+	if (!UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer())
 	{
 		UE_LOG(LogRive, Error, TEXT("RiveRenderer is null, unable to create the RiveTextureResource"));
 		return nullptr;
 	}
 	
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-	
 	// UTexture::ReleaseResource() calls the delete
 	CurrentResource = new FRiveTextureResource(this);
 	SetResource(CurrentResource);
 	InitializeResources();
+	OnRenderResourcesChanged();
 
 	return CurrentResource;
 }
@@ -46,7 +46,7 @@ void URiveTexture::PostLoad()
 {
 	Super::PostLoad();
 	
-	if (!IsRunningCommandlet())
+	if (!IsRunningCommandlet() && ShouldInitializeResourcesOnLoad())
 	{
 		ResizeRenderTargets(Size);
 	}
@@ -54,7 +54,7 @@ void URiveTexture::PostLoad()
 
 void URiveTexture::ResizeRenderTargets(const FIntPoint InNewSize)
 {
-	if (InNewSize.X == SizeX && InNewSize.Y == SizeY)
+	if (CurrentResource && InNewSize.X == SizeX && InNewSize.Y == SizeY)
 	{
 		return;
 	}
@@ -79,6 +79,7 @@ void URiveTexture::ResizeRenderTargets(const FIntPoint InNewSize)
 	{
 		// Create new TextureRHI with new size
 		InitializeResources();
+		OnRenderResourcesChanged();
 	}
 
 	FlushRenderingCommands();
@@ -89,6 +90,70 @@ void URiveTexture::ResizeRenderTargets(const FVector2f InNewSize)
 	ResizeRenderTargets(FIntPoint(InNewSize.X, InNewSize.Y));
 }
 
+void URiveTexture::ReleaseRenderTargets(const FIntPoint InSize)
+{
+	SizeX = Size.X = InSize.X;
+	SizeY = Size.Y = InSize.Y;
+
+	if (CurrentResource)
+	{
+		// UTexture::ReleaseResource deletes it on the Render Thread
+		ReleaseResource();
+		CurrentResource = nullptr;
+	}
+}
+
+URiveTexture* URiveTexture::GetDisplayTexture(FBox2f& OutUVRect) const
+{
+	OutUVRect = FBox2f(FVector2f::ZeroVector, FVector2f::UnitVector);
+	return const_cast<URiveTexture*>(this);
+}
+
+FSlateBrush URiveTexture::MakeDisplayBrush() const
+{
+	FSlateBrush Brush;
+
+	FBox2f DisplayUVRect;
+	Brush.SetResourceObject(GetDisplayTexture(DisplayUVRect));
+	Brush.SetUVRegion(FBox2D(FVector2D(DisplayUVRect.Min), FVector2D(DisplayUVRect.Max)));
+	Brush.SetImageSize(FVector2D(Size));
+
+	return Brush;
+}
+
+void URiveTexture::SetDisplayTextureParameters(UMaterialInstanceDynamic* InMaterial, FName InTextureParameterName, FName InUVRectParameterName) const
+{
+	if (!InMaterial)
+	{
+		return;
+	}
+
+	FBox2f DisplayUVRect;
+	InMaterial->SetTextureParameterValue(InTextureParameterName, GetDisplayTexture(DisplayUVRect));
+	InMaterial->SetVectorParameterValue(InUVRectParameterName, FLinearColor(DisplayUVRect.Min.X, DisplayUVRect.Min.Y, DisplayUVRect.Max.X, DisplayUVRect.Max.Y));
+}
+
+double URiveTexture::GetLastDisplayTime() const
+{
+	double DisplayTime = LastDisplayTime;
+
+	// Materials and brushes referencing this texture sample it, the Rive widgets and display brushes and parameters sample the display texture,
+	// which is an atlas page for the files packed in the atlas
+	if (const FTextureResource* OwnResource = GetResource())
+	{
+		DisplayTime = FMath::Max(DisplayTime, OwnResource->LastRenderTime);
+	}
+
+	FBox2f DisplayUVRect;
+	const URiveTexture* DisplayTexture = GetDisplayTexture(DisplayUVRect);
+	if (const FTextureResource* DisplayResource = DisplayTexture && DisplayTexture != this ? DisplayTexture->GetResource() : nullptr)
+	{
+		DisplayTime = FMath::Max(DisplayTime, DisplayResource->LastRenderTime);
+	}
+
+	return DisplayTime;
+}
+
 FVector2f URiveTexture::GetLocalCoordinatesFromExtents(URiveArtboard* InArtboard, const FVector2f& InPosition, const FBox2f& InExtents) const
 {
 	const FVector2f RelativePosition = InPosition - InExtents.Min;
@@ -164,9 +229,6 @@ void URiveTexture::InitializeResources() const
 	
 	ENQUEUE_RENDER_COMMAND(FRiveTextureResourceeUpdateTextureReference)
 	([this](FRHICommandListImmediate& RHICmdList) {
-		UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-		FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-		
 		FTextureRHIRef RenderableTexture;
 
 		FRHITextureCreateDesc RenderTargetTextureDesc =
@@ -181,7 +243,9 @@ void URiveTexture::InitializeResources() const
 		}
 #endif
 		
-		RenderableTexture = RHICreateTexture(RenderTargetTextureDesc);
+		// The previous texture goes back to the pool first, so it can be reused right away if the size did not change
+		GRiveTexturePool.Release_RenderThread(MoveTemp(CurrentResource->TextureRHI));
+		RenderableTexture = GRiveTexturePool.Acquire_RenderThread(RHICmdList, RenderTargetTextureDesc);
 		RenderableTexture->SetName(GetFName());
 		CurrentResource->TextureRHI = RenderableTexture;
 
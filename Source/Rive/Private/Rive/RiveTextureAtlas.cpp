@@ -0,0 +1,305 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveTextureAtlas.h"
+
+#include "HAL/IConsoleManager.h"
+#include "IRiveRenderer.h"
+#include "IRiveRendererModule.h"
+#include "Logs/RiveLog.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderTargetPool.h"
+#include "Rive/RiveTexture.h"
+#include "Stats/RiveStats.h"
+#include "TextureResource.h"
+
+static TAutoConsoleVariable<int32> CVarRiveAtlasPageSize(
+	TEXT("Rive.Atlas.PageSize"),
+	2048,
+	TEXT("Width and height of the texture atlas pages the Rive Files using the texture atlas are packed in. Only applies to the pages created afterwards."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRiveAtlasMaxEntrySize(
+	TEXT("Rive.Atlas.MaxEntrySize"),
+	512,
+	TEXT("Largest width or height of a Rive File packed in the texture atlas, bigger ones keep rendering to their own texture."),
+	ECVF_Default);
+
+bool URiveTextureAtlas::FPage::Allocate(const FIntPoint& InSlotSize, FIntRect& OutSlotRect)
+{
+	// The smallest free slot fitting is reused as a whole, its leftover is only recovered once the page gets empty
+	int32 BestFreeSlotIndex = INDEX_NONE;
+	for (int32 FreeSlotIndex = 0; FreeSlotIndex < FreeSlots.Num(); ++FreeSlotIndex)
+	{
+		const FIntPoint FreeSlotSize = FreeSlots[FreeSlotIndex].Size();
+		if (FreeSlotSize.X >= InSlotSize.X && FreeSlotSize.Y >= InSlotSize.Y
+			&& (BestFreeSlotIndex == INDEX_NONE || FreeSlotSize.X * FreeSlotSize.Y < FreeSlots[BestFreeSlotIndex].Area()))
+		{
+			BestFreeSlotIndex = FreeSlotIndex;
+		}
+	}
+
+	if (BestFreeSlotIndex != INDEX_NONE)
+	{
+		OutSlotRect = FreeSlots[BestFreeSlotIndex];
+		FreeSlots.RemoveAtSwap(BestFreeSlotIndex);
+		return true;
+	}
+
+	// Otherwise the lowest shelf with enough room left
+	FShelf* BestShelf = nullptr;
+	for (FShelf& Shelf : Shelves)
+	{
+		if (Shelf.Height >= InSlotSize.Y && Shelf.NextX + InSlotSize.X <= Size
+			&& (!BestShelf || Shelf.Height < BestShelf->Height))
+		{
+			BestShelf = &Shelf;
+		}
+	}
+
+	if (!BestShelf)
+	{
+		const int32 NextShelfY = Shelves.IsEmpty() ? 0 : Shelves.Last().Y + Shelves.Last().Height;
+		if (NextShelfY + InSlotSize.Y > Size || InSlotSize.X > Size)
+		{
+			return false;
+		}
+
+		BestShelf = &Shelves.AddDefaulted_GetRef();
+		BestShelf->Y = NextShelfY;
+		BestShelf->Height = InSlotSize.Y;
+	}
+
+	OutSlotRect = FIntRect(BestShelf->NextX, BestShelf->Y, BestShelf->NextX + InSlotSize.X, BestShelf->Y + BestShelf->Height);
+	BestShelf->NextX += InSlotSize.X;
+	return true;
+}
+
+bool URiveTextureAtlas::CanFit(const FIntPoint& InSize)
+{
+	return InSize.X > 0 && InSize.Y > 0 && InSize.GetMax() <= CVarRiveAtlasMaxEntrySize.GetValueOnGameThread();
+}
+
+int32 URiveTextureAtlas::AddEntry(const FName& InRiveName, const FIntPoint& InSize, URiveTexture* InEntryTexture, UE::Rive::Renderer::IRiveRenderTargetPtr& OutRenderTarget)
+{
+	check(IsInGameThread());
+
+	if (!CanFit(InSize))
+	{
+		return INDEX_NONE;
+	}
+
+	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
+	if (!RiveRenderer || !RiveRenderer->IsInitialized())
+	{
+		return INDEX_NONE;
+	}
+
+	FEntry Entry;
+	Entry.Texture = InEntryTexture;
+	Entry.Size = InSize;
+
+	const FIntPoint SlotSize = InSize + FIntPoint(Gutter, Gutter);
+	for (int32 PageIndex = 0; PageIndex < Pages.Num(); ++PageIndex)
+	{
+		if (Pages[PageIndex].Allocate(SlotSize, Entry.SlotRect))
+		{
+			Entry.PageIndex = PageIndex;
+			break;
+		}
+	}
+
+	if (Entry.PageIndex == INDEX_NONE)
+	{
+		const int32 PageIndex = AddPage(*RiveRenderer);
+		if (PageIndex == INDEX_NONE || !Pages[PageIndex].Allocate(SlotSize, Entry.SlotRect))
+		{
+			UE_LOG(LogRive, Warning, TEXT("Unable to allocate '%s' (%dx%d) in the texture atlas, it will render to its own texture."), *InRiveName.ToString(), InSize.X, InSize.Y);
+			return INDEX_NONE;
+		}
+		Entry.PageIndex = PageIndex;
+	}
+
+	Entry.RenderTarget = RiveRenderer->CreateAtlasEntryTarget_GameThread(InRiveName, InSize);
+	OutRenderTarget = Entry.RenderTarget;
+
+	FPage& Page = Pages[Entry.PageIndex];
+	const int32 EntryHandle = Entries.Add(MoveTemp(Entry));
+	Page.EntryHandles.Add(EntryHandle);
+	Page.bIsDirty = true;
+
+	return EntryHandle;
+}
+
+void URiveTextureAtlas::RemoveEntry(int32 InEntryHandle)
+{
+	check(IsInGameThread());
+
+	if (!Entries.IsValidIndex(InEntryHandle))
+	{
+		return;
+	}
+
+	const FEntry& Entry = Entries[InEntryHandle];
+	FPage& Page = Pages[Entry.PageIndex];
+	Page.EntryHandles.RemoveSwap(InEntryHandle);
+	if (Page.EntryHandles.IsEmpty())
+	{
+		Page.Shelves.Reset();
+		Page.FreeSlots.Reset();
+	}
+	else
+	{
+		Page.FreeSlots.Add(Entry.SlotRect);
+	}
+	Page.bIsDirty = true;
+
+	Entries.RemoveAt(InEntryHandle);
+}
+
+void URiveTextureAtlas::MarkEntryDirty(int32 InEntryHandle)
+{
+	if (Entries.IsValidIndex(InEntryHandle))
+	{
+		FEntry& Entry = Entries[InEntryHandle];
+		Entry.bNeedsCopy = true;
+		Pages[Entry.PageIndex].bIsDirty = true;
+	}
+}
+
+URiveTexture* URiveTextureAtlas::GetEntryTexture(int32 InEntryHandle, FBox2f& OutUVRect) const
+{
+	if (!Entries.IsValidIndex(InEntryHandle))
+	{
+		return nullptr;
+	}
+
+	const FEntry& Entry = Entries[InEntryHandle];
+	const float PageSize = Pages[Entry.PageIndex].Size;
+	OutUVRect = FBox2f(FVector2f(Entry.SlotRect.Min) / PageSize, FVector2f(Entry.SlotRect.Min + Entry.Size) / PageSize);
+	return PageTextures[Entry.PageIndex];
+}
+
+void URiveTextureAtlas::SubmitPages()
+{
+	check(IsInGameThread());
+
+	for (FPage& Page : Pages)
+	{
+		if (!Page.bIsDirty)
+		{
+			continue;
+		}
+
+		Page.bIsDirty = false;
+		for (const int32 EntryHandle : Page.EntryHandles)
+		{
+			FEntry& Entry = Entries[EntryHandle];
+			Page.RenderTarget->DrawAtlasEntry(Entry.RenderTarget.ToSharedRef(), Entry.SlotRect.Min);
+
+			// The other entries of the page are redrawn from the same submission, their texture already holds it
+			if (Entry.bNeedsCopy && Entry.Texture.IsValid())
+			{
+				Entry.bNeedsCopy = false;
+				DrawnEntryHandles.Add(EntryHandle);
+			}
+		}
+		Page.RenderTarget->SubmitAndClear();
+
+		INC_DWORD_STAT(STAT_RiveAtlasPagesDrawn);
+		INC_DWORD_STAT_BY(STAT_RiveAtlasEntriesDrawn, Page.EntryHandles.Num());
+	}
+}
+
+void URiveTextureAtlas::CopyDrawnEntries()
+{
+	check(IsInGameThread());
+
+	struct FEntryCopy
+	{
+		FTextureResource* PageResource = nullptr;
+
+		FTextureResource* EntryResource = nullptr;
+
+		FIntPoint Position = FIntPoint::ZeroValue;
+
+		FIntPoint Size = FIntPoint::ZeroValue;
+	};
+
+	TArray<FEntryCopy> EntryCopies;
+	for (const int32 EntryHandle : DrawnEntryHandles)
+	{
+		if (!Entries.IsValidIndex(EntryHandle))
+		{
+			continue;
+		}
+
+		const FEntry& Entry = Entries[EntryHandle];
+		const URiveTexture* EntryTexture = Entry.Texture.Get();
+		FTextureResource* EntryResource = EntryTexture ? EntryTexture->GetResource() : nullptr;
+		FTextureResource* PageResource = PageTextures[Entry.PageIndex]->GetResource();
+		if (EntryResource && PageResource)
+		{
+			EntryCopies.Add({ PageResource, EntryResource, Entry.SlotRect.Min, Entry.Size });
+		}
+	}
+	DrawnEntryHandles.Reset();
+
+	if (EntryCopies.IsEmpty())
+	{
+		return;
+	}
+
+	// Enqueued after the render batch, so it runs after the page draws. The resources are released by later render commands if their textures go away meanwhile
+	ENQUEUE_RENDER_COMMAND(RiveAtlasCopyEntries)([EntryCopies = MoveTemp(EntryCopies)](FRHICommandListImmediate& RHICmdList)
+	{
+		FRDGBuilder GraphBuilder(RHICmdList);
+		for (const FEntryCopy& EntryCopy : EntryCopies)
+		{
+			FRHITexture* PageTexture = EntryCopy.PageResource->GetTexture2DRHI();
+			FRHITexture* EntryTexture = EntryCopy.EntryResource->GetTexture2DRHI();
+			if (!PageTexture || !EntryTexture)
+			{
+				continue;
+			}
+
+			const FIntVector EntryTextureSize = EntryTexture->GetSizeXYZ();
+			FRHICopyTextureInfo CopyInfo;
+			CopyInfo.SourcePosition = FIntVector(EntryCopy.Position.X, EntryCopy.Position.Y, 0);
+			CopyInfo.Size = FIntVector(FMath::Min(EntryCopy.Size.X, EntryTextureSize.X), FMath::Min(EntryCopy.Size.Y, EntryTextureSize.Y), 1);
+
+			AddCopyTexturePass(GraphBuilder,
+				GraphBuilder.RegisterExternalTexture(CreateRenderTarget(PageTexture, TEXT("RiveAtlasPage"))),
+				GraphBuilder.RegisterExternalTexture(CreateRenderTarget(EntryTexture, TEXT("RiveAtlasEntry"))),
+				CopyInfo);
+		}
+		GraphBuilder.Execute();
+	});
+}
+
+int32 URiveTextureAtlas::AddPage(UE::Rive::Renderer::IRiveRenderer& InRiveRenderer)
+{
+	const int32 PageSize = FMath::Clamp(CVarRiveAtlasPageSize.GetValueOnGameThread(), 256, RIVE_MAX_TEX_RESOLUTION - 1);
+
+	URiveTexture* PageTexture = NewObject<URiveTexture>(this, MakeUniqueObjectName(this, URiveTexture::StaticClass(), TEXT("RiveAtlasPage")), RF_Transient);
+	PageTexture->ResizeRenderTargets(FIntPoint(PageSize, PageSize));
+
+	const UE::Rive::Renderer::IRiveRenderTargetPtr PageRenderTarget = InRiveRenderer.CreateTextureTarget_GameThread(PageTexture->GetFName(), PageTexture);
+	if (!PageRenderTarget)
+	{
+		return INDEX_NONE;
+	}
+
+	PageRenderTarget->SetClearColor(FLinearColor::Transparent);
+	PageTexture->OnResourceInitializedOnRenderThread.AddLambda([PageRenderTarget](FRHICommandListImmediate& RHICmdList, FTextureRHIRef& NewResource)
+	{
+		PageRenderTarget->CacheTextureTarget_RenderThread(RHICmdList, NewResource);
+	});
+	PageRenderTarget->Initialize();
+
+	PageTextures.Add(PageTexture);
+	FPage& Page = Pages.AddDefaulted_GetRef();
+	Page.RenderTarget = PageRenderTarget;
+	Page.Size = PageSize;
+	return Pages.Num() - 1;
+}
@@ -0,0 +1,123 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IRiveRenderTarget.h"
+#include "UObject/Object.h"
+#include "RiveTextureAtlas.generated.h"
+
+class URiveTexture;
+
+namespace UE::Rive::Renderer
+{
+	class IRiveRenderer;
+}
+
+/**
+ * Packs the Render Targets of small Rive Files as sub-rects of shared texture pages, so all the files of a page are drawn in a single PLS frame and flush
+ * instead of one each. Entries are shelf-packed with a gutter between them, and a page is redrawn as a whole from the last submission of each of its entries
+ * once any of them changed. Entries are displayed by sampling their page with their UV rect, only the entries given a texture get copied to it after they changed.
+ */
+UCLASS(Transient)
+class URiveTextureAtlas : public UObject
+{
+	GENERATED_BODY()
+
+	/**
+	 * Implementation(s)
+	 */
+
+public:
+
+	/** Returns true if a Render Target of the given size is small enough to be packed, see Rive.Atlas.MaxEntrySize */
+	static bool CanFit(const FIntPoint& InSize);
+
+	/**
+	 * Allocates a sub-rect of a page and creates the Render Target drawing into it
+	 * @param InEntryTexture Texture the entry is copied to after each redraw, of at least the given size, null to only display it from the page
+	 * @return Handle of the entry, INDEX_NONE if it could not be allocated
+	 */
+	int32 AddEntry(const FName& InRiveName, const FIntPoint& InSize, URiveTexture* InEntryTexture, UE::Rive::Renderer::IRiveRenderTargetPtr& OutRenderTarget);
+
+	void RemoveEntry(int32 InEntryHandle);
+
+	/** Flags the page of the entry for redraw, to be called after each submission of the entry Render Target */
+	void MarkEntryDirty(int32 InEntryHandle);
+
+	/** Returns the page texture holding the entry, and the UV rect of the entry in it */
+	URiveTexture* GetEntryTexture(int32 InEntryHandle, FBox2f& OutUVRect) const;
+
+	/** Redraws the pages with a dirty entry, called once all the tickables submitted their draws for the frame */
+	void SubmitPages();
+
+	/** Copies the entries redrawn by SubmitPages to their texture, called once the render batch holding the page draws was sent to the Render Thread */
+	void CopyDrawnEntries();
+
+private:
+
+	int32 AddPage(UE::Rive::Renderer::IRiveRenderer& InRiveRenderer);
+
+	/**
+	 * Attribute(s)
+	 */
+
+private:
+
+	/** Pixels left empty on the right and bottom of each entry, so bilinear sampling does not bleed into the neighbours */
+	static constexpr int32 Gutter = 2;
+
+	struct FEntry
+	{
+		UE::Rive::Renderer::IRiveRenderTargetPtr RenderTarget;
+
+		TWeakObjectPtr<URiveTexture> Texture;
+
+		int32 PageIndex = INDEX_NONE;
+
+		FIntPoint Size = FIntPoint::ZeroValue;
+
+		/** Space allocated to the entry in the page, gutter included */
+		FIntRect SlotRect;
+
+		/** Set once the entry changed, until its next redraw is copied to Texture, if any */
+		bool bNeedsCopy = true;
+	};
+
+	struct FShelf
+	{
+		int32 Y = 0;
+
+		int32 Height = 0;
+
+		int32 NextX = 0;
+	};
+
+	struct FPage
+	{
+		UE::Rive::Renderer::IRiveRenderTargetPtr RenderTarget;
+
+		int32 Size = 0;
+
+		TArray<FShelf> Shelves;
+
+		/** Slots of the removed entries, reused before growing the shelves */
+		TArray<FIntRect> FreeSlots;
+
+		TArray<int32> EntryHandles;
+
+		bool bIsDirty = false;
+
+		bool Allocate(const FIntPoint& InSlotSize, FIntRect& OutSlotRect);
+	};
+
+	UPROPERTY()
+	TArray<TObjectPtr<URiveTexture>> PageTextures;
+
+	TArray<FPage> Pages;
+
+	TSparseArray<FEntry> Entries;
+
+	/** Entries redrawn by the last SubmitPages */
+	TArray<int32> DrawnEntryHandles;
+};
@@ -0,0 +1,112 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveTexturePool.h"
+
+#include "HAL/IConsoleManager.h"
+#include "RenderUtils.h"
+#include "RHICommandList.h"
+#include "Stats/RiveStats.h"
+
+static TAutoConsoleVariable<int32> CVarRiveTexturePoolMaxPooledMB(
+	TEXT("Rive.TexturePool.MaxPooledMB"),
+	64,
+	TEXT("Size in MB of the unused Rive Texture render targets kept for reuse, 0 frees them as soon as their Rive Texture is resized or destroyed.\n")
+	TEXT("See 'Texture Pool (Live)' and 'Texture Pool (Pooled)' in 'stat Rive'."),
+	ECVF_RenderThreadSafe);
+
+TGlobalResource<FRiveTexturePool> GRiveTexturePool;
+
+void FRiveTexturePool::ReleaseRHI()
+{
+	Trim_RenderThread(0);
+}
+
+FTextureRHIRef FRiveTexturePool::Acquire_RenderThread(FRHICommandListImmediate& RHICmdList, const FRHITextureCreateDesc& InDesc)
+{
+	check(IsInRenderingThread());
+
+	FTextureRHIRef Texture;
+	const int32 PooledIndex = PooledTextures.IndexOfByPredicate([&InDesc](const FTextureRHIRef& PooledTexture)
+	{
+		return IsMatching(PooledTexture->GetDesc(), InDesc);
+	});
+
+	if (PooledIndex != INDEX_NONE)
+	{
+		Texture = MoveTemp(PooledTextures[PooledIndex]);
+		PooledTextures.RemoveAt(PooledIndex);
+
+		const uint64 TextureBytes = GetTextureBytes(Texture->GetDesc());
+		PooledBytes -= TextureBytes;
+		DEC_MEMORY_STAT_BY(STAT_RiveTexturePoolPooledMemory, TextureBytes);
+
+		// The previous content would otherwise show until the first draw of the new owner
+		RHICmdList.Transition(FRHITransitionInfo(Texture, ERHIAccess::Unknown, ERHIAccess::RTV));
+		FRHIRenderPassInfo RenderPassInfo(Texture, ERenderTargetActions::Clear_Store);
+		RHICmdList.BeginRenderPass(RenderPassInfo, TEXT("ClearPooledRiveTexture"));
+		RHICmdList.EndRenderPass();
+		RHICmdList.Transition(FRHITransitionInfo(Texture, ERHIAccess::RTV, ERHIAccess::SRVMask));
+	}
+	else
+	{
+		Texture = RHICreateTexture(InDesc);
+	}
+
+	INC_MEMORY_STAT_BY(STAT_RiveTexturePoolLiveMemory, GetTextureBytes(Texture->GetDesc()));
+	return Texture;
+}
+
+void FRiveTexturePool::Release_RenderThread(FTextureRHIRef&& InTexture)
+{
+	check(IsInRenderingThread());
+
+	if (!InTexture)
+	{
+		return;
+	}
+
+	const uint64 TextureBytes = GetTextureBytes(InTexture->GetDesc());
+	DEC_MEMORY_STAT_BY(STAT_RiveTexturePoolLiveMemory, TextureBytes);
+
+	// Released while the RHI shuts down, once the pool itself got emptied
+	if (!IsInitialized())
+	{
+		InTexture.SafeRelease();
+		return;
+	}
+
+	PooledTextures.Add(MoveTemp(InTexture));
+	PooledBytes += TextureBytes;
+	INC_MEMORY_STAT_BY(STAT_RiveTexturePoolPooledMemory, TextureBytes);
+
+	Trim_RenderThread(static_cast<uint64>(FMath::Max(CVarRiveTexturePoolMaxPooledMB.GetValueOnRenderThread(), 0)) * 1024 * 1024);
+}
+
+void FRiveTexturePool::Trim_RenderThread(uint64 InMaxPooledBytes)
+{
+	int32 NumTrimmed = 0;
+	while (NumTrimmed < PooledTextures.Num() && PooledBytes > InMaxPooledBytes)
+	{
+		const uint64 TextureBytes = GetTextureBytes(PooledTextures[NumTrimmed]->GetDesc());
+		PooledBytes -= TextureBytes;
+		DEC_MEMORY_STAT_BY(STAT_RiveTexturePoolPooledMemory, TextureBytes);
+		++NumTrimmed;
+	}
+
+	PooledTextures.RemoveAt(0, NumTrimmed);
+}
+
+uint64 FRiveTexturePool::GetTextureBytes(const FRHITextureDesc& InDesc)
+{
+	return CalcTextureSize(InDesc.Extent.X, InDesc.Extent.Y, InDesc.Format, InDesc.NumMips);
+}
+
+bool FRiveTexturePool::IsMatching(const FRHITextureDesc& InDesc, const FRHITextureCreateDesc& InCreateDesc)
+{
+	return InDesc.Extent == InCreateDesc.Extent
+		&& InDesc.Format == InCreateDesc.Format
+		&& InDesc.Flags == InCreateDesc.Flags
+		&& InDesc.NumMips == InCreateDesc.NumMips
+		&& InDesc.NumSamples == InCreateDesc.NumSamples
+		&& InDesc.ClearValue == InCreateDesc.ClearValue;
+}
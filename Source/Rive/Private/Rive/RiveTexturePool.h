@@ -0,0 +1,55 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "RenderResource.h"
+#include "RHI.h"
+
+/**
+ * Recycles the RHI textures of the Rive Textures, keyed by size, format and flags, so resizing or destroying a Rive Texture
+ * does not free a render target which the next one of the same size would allocate again.
+ * Render Thread only. The textures kept unused are capped by Rive.TexturePool.MaxPooledMB, the oldest ones being freed first.
+ */
+class FRiveTexturePool : public FRenderResource
+{
+	//~ BEGIN : FRenderResource Interface
+
+public:
+
+	virtual void ReleaseRHI() override;
+
+	//~ END : FRenderResource Interface
+
+	/**
+	 * Implementation(s)
+	 */
+
+public:
+
+	/** Returns an unused pooled texture matching the description, cleared to its clear value, or creates a new one */
+	FTextureRHIRef Acquire_RenderThread(FRHICommandListImmediate& RHICmdList, const FRHITextureCreateDesc& InDesc);
+
+	/** Gives back a texture returned by Acquire_RenderThread, it must not be used by the caller afterwards */
+	void Release_RenderThread(FTextureRHIRef&& InTexture);
+
+private:
+
+	void Trim_RenderThread(uint64 InMaxPooledBytes);
+
+	static uint64 GetTextureBytes(const FRHITextureDesc& InDesc);
+
+	static bool IsMatching(const FRHITextureDesc& InDesc, const FRHITextureCreateDesc& InCreateDesc);
+
+	/**
+	 * Attribute(s)
+	 */
+
+private:
+
+	/** Unused textures, the oldest first */
+	TArray<FTextureRHIRef> PooledTextures;
+
+	uint64 PooledBytes = 0;
+};
+
+extern TGlobalResource<FRiveTexturePool> GRiveTexturePool;
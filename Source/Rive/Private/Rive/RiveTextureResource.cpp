@@ -5,16 +5,9 @@
 
 #include "DeviceProfiles/DeviceProfile.h"
 #include "DeviceProfiles/DeviceProfileManager.h"
-#include "IRiveRenderer.h"
-#include "IRiveRendererModule.h"
-#include "Logs/RiveLog.h"
 #include "RenderUtils.h"
 #include "Rive/RiveTexture.h"
-
-namespace UE::Rive::Renderer
-{
-	class IRiveRenderer;
-}
+#include "RiveTexturePool.h"
 
 FRiveTextureResource::FRiveTextureResource(URiveTexture* Owner)
 {
@@ -23,15 +16,6 @@ FRiveTextureResource::FRiveTextureResource(URiveTexture* Owner)
 
 void FRiveTextureResource::InitRHI(FRHICommandListBase& RHICmdList)
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (!UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer())
-	{
-		UE_LOG(LogRive, Error, TEXT("Failed to InitRHI for the RiveTextureResource as we do not have a valid renderer."));
-		return;
-	}
-	
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-	
 	if (RiveTexture)
 	{
 		FSamplerStateInitializerRHI SamplerStateInitializer(
@@ -43,25 +27,13 @@ void FRiveTextureResource::InitRHI(FRHICommandListBase& RHICmdList)
 
 void FRiveTextureResource::ReleaseRHI()
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (ensure(RiveRenderer))
-	{
-		RiveRenderer->GetThreadDataCS().Lock();
-	}
-	
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-	
 	if (RiveTexture)
 	{
 		RHIUpdateTextureReference(RiveTexture->TextureReference.TextureReferenceRHI, nullptr);
 	}
 
+	GRiveTexturePool.Release_RenderThread(MoveTemp(TextureRHI));
 	FTextureResource::ReleaseRHI();
-
-	if (RiveRenderer)
-	{
-		RiveRenderer->GetThreadDataCS().Unlock();
-	}
 }
 
 uint32 FRiveTextureResource::GetSizeX() const
@@ -0,0 +1,356 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveTickSubsystem.h"
+
+#include "HAL/IConsoleManager.h"
+#include "IRiveRenderer.h"
+#include "IRiveRendererModule.h"
+#include "RiveArtboard.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/App.h"
+#include "Rive/RiveTickable.h"
+#include "RiveTextureAtlas.h"
+#include "Stats/RiveStats.h"
+
+static TAutoConsoleVariable<bool> CVarRiveTickParallelAdvance(
+	TEXT("Rive.Tick.ParallelAdvance"),
+	true,
+	TEXT("If true, the State Machines of the Artboards which do not override their State Machine tick are advanced in parallel on worker threads.\n")
+	TEXT("Compare 'Advance (Serial)' and 'Advance (Parallel)' in 'stat Rive' when toggling it."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRiveTickTimeSliceBudgetMs(
+	TEXT("Rive.Tick.TimeSliceBudgetMs"),
+	1.f,
+	TEXT("Milliseconds spent each frame advancing and rendering the time-sliced Rive tickables, the ones not reached are ticked on the next frames in round-robin.\n")
+	TEXT("At least one time-sliced tickable is ticked each frame."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarRiveSuspendOffscreen(
+	TEXT("Rive.Suspend.Offscreen"),
+	true,
+	TEXT("If true, the Rive tickables which were not displayed for Rive.Suspend.GracePeriod are neither advanced nor drawn until they are displayed again.\n")
+	TEXT("Only applies to the tickables opting in with bSuspendWhenOffscreen, as brushes and canvas draws sampling their texture are not detected."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRiveSuspendGracePeriod(
+	TEXT("Rive.Suspend.GracePeriod"),
+	0.5f,
+	TEXT("Seconds a Rive tickable keeps ticking after it was last displayed, so briefly occluded or scrolled out content does not stall when it comes back."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRiveSuspendMaxCatchUpSeconds(
+	TEXT("Rive.Suspend.MaxCatchUpSeconds"),
+	1.f,
+	TEXT("Maximum time a suspended Rive tickable is advanced by when it is displayed again, the rest of the suspended time is dropped."),
+	ECVF_Default);
+
+TArray<URiveTickSubsystem::FRegisteredTickable> URiveTickSubsystem::Tickables;
+TArray<URiveTickSubsystem::FFrameTickable> URiveTickSubsystem::FrameTickables;
+TArray<URiveTickSubsystem::FFrameTickable> URiveTickSubsystem::FrameTimeSlicedTickables;
+
+void URiveTickSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	TextureAtlas = NewObject<URiveTextureAtlas>(this);
+	bIsInitialized = true;
+}
+
+void URiveTickSubsystem::Deinitialize()
+{
+	bIsInitialized = false;
+	TextureAtlas = nullptr;
+	Super::Deinitialize();
+}
+
+TStatId URiveTickSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URiveTickSubsystem, STATGROUP_Tickables);
+}
+
+void URiveTickSubsystem::Tick(float InDeltaSeconds)
+{
+#if WITH_RIVE
+	SCOPE_CYCLE_COUNTER(STAT_RiveTick);
+
+	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
+	if (!RiveRenderer || !RiveRenderer->IsInitialized())
+	{
+		return;
+	}
+
+	FrameTickables.Reset();
+	FrameTimeSlicedTickables.Reset();
+	int32 NumDeferredTickables = 0;
+	int32 NumSuspendedTickables = 0;
+	const double CurrentTime = FApp::GetCurrentTime();
+	for (int32 TickableIndex = 0; TickableIndex < Tickables.Num(); ++TickableIndex)
+	{
+		FRegisteredTickable& RegisteredTickable = Tickables[TickableIndex];
+		if (!RegisteredTickable.Tickable->IsRiveTickable())
+		{
+			// The time it was not tickable for is not caught up
+			RegisteredTickable.AccumulatedDeltaSeconds = 0.f;
+			continue;
+		}
+
+		// The tickables of a World follow its pause and time dilation, as their component tick would
+		float DeltaSeconds = InDeltaSeconds;
+		if (const UWorld* TickWorld = RegisteredTickable.Tickable->GetRiveTickWorld())
+		{
+			if (TickWorld->IsPaused())
+			{
+				continue;
+			}
+			DeltaSeconds = TickWorld->GetDeltaSeconds();
+		}
+
+		if (IsSuspended(RegisteredTickable, CurrentTime))
+		{
+			// Accumulated up to a cap, so the first tick once displayed again catches up with a single advance
+			RegisteredTickable.AccumulatedDeltaSeconds = FMath::Min(RegisteredTickable.AccumulatedDeltaSeconds + DeltaSeconds, CVarRiveSuspendMaxCatchUpSeconds.GetValueOnGameThread());
+			++NumSuspendedTickables;
+			continue;
+		}
+
+		RegisteredTickable.AccumulatedDeltaSeconds += DeltaSeconds;
+		if (!IsTickDue(RegisteredTickable, DeltaSeconds))
+		{
+			if (RegisteredTickable.Tickable->GetRiveUpdateRate() == ERiveUpdateRate::OnDemand)
+			{
+				// Idle time is not caught up either, the State Machine had settled meanwhile
+				RegisteredTickable.AccumulatedDeltaSeconds = 0.f;
+			}
+			++NumDeferredTickables;
+			continue;
+		}
+
+		const FFrameTickable FrameTickable { RegisteredTickable.Tickable, RegisteredTickable.AccumulatedDeltaSeconds, TickableIndex };
+		if (RegisteredTickable.Tickable->IsRiveTimeSliced())
+		{
+			// Its time keeps accumulating until the time-slicer gets to it
+			FrameTimeSlicedTickables.Add(FrameTickable);
+		}
+		else
+		{
+			RegisteredTickable.AccumulatedDeltaSeconds = 0.f;
+			FrameTickables.Add(FrameTickable);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_RiveDeferredTickables, NumDeferredTickables);
+	SET_DWORD_STAT(STAT_RiveSuspendedTickables, NumSuspendedTickables);
+
+	if (FrameTickables.IsEmpty() && FrameTimeSlicedTickables.IsEmpty())
+	{
+		return;
+	}
+
+	// Advance: the events reported by the previous advance are broadcast on the Game Thread, then the independent State Machines are advanced in parallel
+	const bool bParallelAdvance = CVarRiveTickParallelAdvance.GetValueOnGameThread();
+	ParallelArtboards.Reset();
+	int32 NumSerialArtboards = 0;
+	for (const FFrameTickable& FrameTickable : FrameTickables)
+	{
+		if (!FrameTickable.Tickable)
+		{
+			continue;
+		}
+
+		FrameArtboards.Reset();
+		FrameTickable.Tickable->GetRiveTickArtboards(FrameArtboards);
+		for (URiveArtboard* Artboard : FrameArtboards)
+		{
+			if (!IsValid(Artboard) || !Artboard->IsInitialized())
+			{
+				continue;
+			}
+
+			if (bParallelAdvance && Artboard->CanAdvanceStateMachineOffGameThread())
+			{
+				if (Artboard->PreAdvanceStateMachine_GameThread())
+				{
+					ParallelArtboards.Emplace(Artboard, FrameTickable.DeltaSeconds);
+				}
+			}
+			else
+			{
+				SCOPE_CYCLE_COUNTER(STAT_RiveAdvanceSerial);
+				Artboard->Tick_StateMachine(FrameTickable.DeltaSeconds);
+				++NumSerialArtboards;
+			}
+		}
+	}
+
+	if (!ParallelArtboards.IsEmpty())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_RiveAdvanceParallel);
+		ParallelFor(ParallelArtboards.Num(), [this](int32 ArtboardIndex)
+		{
+			const TPair<URiveArtboard*, float>& ParallelArtboard = ParallelArtboards[ArtboardIndex];
+			ParallelArtboard.Key->AdvanceStateMachine_AnyThread(ParallelArtboard.Value);
+		}, ParallelArtboards.Num() == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
+	SET_DWORD_STAT(STAT_RiveAdvancedArtboardsSerial, NumSerialArtboards);
+	SET_DWORD_STAT(STAT_RiveAdvancedArtboardsParallel, ParallelArtboards.Num());
+
+	// Render: all the submissions of this frame are sent to the Render Thread at once
+	RiveRenderer->BeginRenderBatch_GameThread();
+	for (const FFrameTickable& FrameTickable : FrameTickables)
+	{
+		if (FrameTickable.Tickable)
+		{
+			FrameTickable.Tickable->RiveTick_Render(FrameTickable.DeltaSeconds);
+		}
+	}
+	TickTimeSliced();
+	if (TextureAtlas)
+	{
+		TextureAtlas->SubmitPages();
+	}
+	RiveRenderer->EndRenderBatch_GameThread();
+	if (TextureAtlas)
+	{
+		TextureAtlas->CopyDrawnEntries();
+	}
+
+	FrameTickables.Reset();
+	FrameTimeSlicedTickables.Reset();
+#endif // WITH_RIVE
+}
+
+void URiveTickSubsystem::RegisterTickable(IRiveTickable* InTickable)
+{
+	check(IsInGameThread());
+
+	if (InTickable && !Tickables.ContainsByPredicate([InTickable](const FRegisteredTickable& RegisteredTickable) { return RegisteredTickable.Tickable == InTickable; }))
+	{
+		Tickables.Add({InTickable, 0.f, FApp::GetCurrentTime()});
+	}
+}
+
+void URiveTickSubsystem::UnregisterTickable(IRiveTickable* InTickable)
+{
+	check(IsInGameThread());
+
+	Tickables.RemoveAll([InTickable](const FRegisteredTickable& RegisteredTickable) { return RegisteredTickable.Tickable == InTickable; });
+
+	for (TArray<FFrameTickable>* Frame : {&FrameTickables, &FrameTimeSlicedTickables})
+	{
+		for (FFrameTickable& FrameTickable : *Frame)
+		{
+			if (FrameTickable.Tickable == InTickable)
+			{
+				FrameTickable.Tickable = nullptr;
+			}
+		}
+	}
+}
+
+URiveTextureAtlas* URiveTickSubsystem::GetTextureAtlas()
+{
+	const URiveTickSubsystem* TickSubsystem = GEngine ? GEngine->GetEngineSubsystem<URiveTickSubsystem>() : nullptr;
+	return TickSubsystem ? TickSubsystem->TextureAtlas.Get() : nullptr;
+}
+
+bool URiveTickSubsystem::IsSuspended(const FRegisteredTickable& InRegisteredTickable, double InCurrentTime)
+{
+	if (!CVarRiveSuspendOffscreen.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	const TOptional<double> LastDisplayTime = InRegisteredTickable.Tickable->GetRiveLastDisplayTime();
+	if (!LastDisplayTime.IsSet())
+	{
+		return false;
+	}
+
+	return InCurrentTime - FMath::Max(LastDisplayTime.GetValue(), InRegisteredTickable.RegisteredTime) > CVarRiveSuspendGracePeriod.GetValueOnGameThread();
+}
+
+bool URiveTickSubsystem::IsTickDue(const FRegisteredTickable& InRegisteredTickable, float InDeltaSeconds)
+{
+	float UpdateInterval = 0.f;
+	switch (InRegisteredTickable.Tickable->GetRiveUpdateRate())
+	{
+	case ERiveUpdateRate::EveryFrame:
+		return true;
+	case ERiveUpdateRate::Hz60:
+		UpdateInterval = 1.f / 60.f;
+		break;
+	case ERiveUpdateRate::Hz30:
+		UpdateInterval = 1.f / 30.f;
+		break;
+	case ERiveUpdateRate::Hz15:
+		UpdateInterval = 1.f / 15.f;
+		break;
+	case ERiveUpdateRate::OnDemand:
+		return InRegisteredTickable.Tickable->HasPendingRiveUpdate();
+	}
+
+	// Due on the frame closest to the interval, so 30 Hz at 60 fps ticks every other frame rather than drifting to every third one
+	return InRegisteredTickable.AccumulatedDeltaSeconds + InDeltaSeconds * 0.5f >= UpdateInterval;
+}
+
+void URiveTickSubsystem::TickTimeSliced()
+{
+	if (FrameTimeSlicedTickables.IsEmpty())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_RiveTickTimeSliced);
+
+	// Starts from the first one at or after the cursor, so each time-sliced tickable gets its turn
+	int32 StartIndex = FrameTimeSlicedTickables.IndexOfByPredicate([this](const FFrameTickable& FrameTickable) { return FrameTickable.TickableIndex >= TimeSliceCursor; });
+	if (StartIndex == INDEX_NONE)
+	{
+		StartIndex = 0;
+	}
+
+	const double BudgetSeconds = CVarRiveTickTimeSliceBudgetMs.GetValueOnGameThread() / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumTicked = 0;
+	for (; NumTicked < FrameTimeSlicedTickables.Num(); ++NumTicked)
+	{
+		if (NumTicked > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+
+		const FFrameTickable& FrameTickable = FrameTimeSlicedTickables[(StartIndex + NumTicked) % FrameTimeSlicedTickables.Num()];
+		TimeSliceCursor = FrameTickable.TickableIndex + 1;
+		if (!FrameTickable.Tickable)
+		{
+			continue;
+		}
+
+		// Advanced serially, so the budget accounts for the advance as well
+		FrameArtboards.Reset();
+		FrameTickable.Tickable->GetRiveTickArtboards(FrameArtboards);
+		for (URiveArtboard* Artboard : FrameArtboards)
+		{
+			if (IsValid(Artboard) && Artboard->IsInitialized())
+			{
+				Artboard->Tick_StateMachine(FrameTickable.DeltaSeconds);
+			}
+		}
+
+		if (FrameTickable.Tickable)
+		{
+			FrameTickable.Tickable->RiveTick_Render(FrameTickable.DeltaSeconds);
+		}
+
+		if (FRegisteredTickable* RegisteredTickable = Tickables.FindByPredicate([&FrameTickable](const FRegisteredTickable& Registered) { return Registered.Tickable == FrameTickable.Tickable; }))
+		{
+			RegisteredTickable->AccumulatedDeltaSeconds = 0.f;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_RiveTimeSlicedTickables, NumTicked);
+	SET_DWORD_STAT(STAT_RiveTimeSlicedDeferredTickables, FrameTimeSlicedTickables.Num() - NumTicked);
+}
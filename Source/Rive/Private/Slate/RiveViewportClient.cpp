@@ -70,11 +70,17 @@ void FRiveViewportClient::Draw(FViewport* Viewport, FCanvas* Canvas)
 	}
 #endif
 	
-	if (RiveTexture->GetResource() != nullptr)
+	RiveTexture->MarkDisplayed();
+
+	FBox2f DisplayUVRect;
+	const URiveTexture* DisplayTexture = RiveTexture->GetDisplayTexture(DisplayUVRect);
+	if (DisplayTexture && DisplayTexture->GetResource() != nullptr)
 	{
 		FCanvasTileItem TileItem(FVector2D{RiveTextureBox.Min},
-			RiveTexture->GetResource(),
+			DisplayTexture->GetResource(),
 			FVector2D{RiveTextureSize},
+			FVector2D{DisplayUVRect.Min},
+			FVector2D{DisplayUVRect.Max},
 			FLinearColor::White);
 		TileItem.BlendMode = RiveTexture->GetSimpleElementBlendMode();
 		TileItem.BatchedElementParameters = nullptr;
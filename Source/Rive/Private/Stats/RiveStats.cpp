@@ -1,3 +1,20 @@
 // Copyright Rive, Inc. All rights reserved.
 
 #include "RiveStats.h"
+
+DEFINE_STAT(STAT_RiveTick);
+DEFINE_STAT(STAT_RiveAdvanceSerial);
+DEFINE_STAT(STAT_RiveAdvanceParallel);
+DEFINE_STAT(STAT_RiveAdvancedArtboardsSerial);
+DEFINE_STAT(STAT_RiveAdvancedArtboardsParallel);
+DEFINE_STAT(STAT_RiveSkippedRedraws);
+DEFINE_STAT(STAT_RiveAtlasPagesDrawn);
+DEFINE_STAT(STAT_RiveAtlasEntriesDrawn);
+DEFINE_STAT(STAT_RiveTexturePoolLiveMemory);
+DEFINE_STAT(STAT_RiveTexturePoolPooledMemory);
+DEFINE_STAT(STAT_RiveDeferredTickables);
+DEFINE_STAT(STAT_RiveTickTimeSliced);
+DEFINE_STAT(STAT_RiveTimeSlicedTickables);
+DEFINE_STAT(STAT_RiveFileImport);
+DEFINE_STAT(STAT_RiveTimeSlicedDeferredTickables);
+DEFINE_STAT(STAT_RiveSuspendedTickables);
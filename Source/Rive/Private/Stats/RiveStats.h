@@ -5,3 +5,46 @@
 #include "Stats/Stats2.h"
 
 DECLARE_STATS_GROUP(TEXT("Rive"), STATGROUP_Rive, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick"), STAT_RiveTick, STATGROUP_Rive, );
+
+/** State Machines advanced one after the other on the Game Thread (overridden ticks, or Rive.Tick.ParallelAdvance disabled) */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Advance (Serial)"), STAT_RiveAdvanceSerial, STATGROUP_Rive, );
+
+/** Wall time of the State Machines advanced with ParallelFor */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Advance (Parallel)"), STAT_RiveAdvanceParallel, STATGROUP_Rive, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Advanced Artboards (Serial)"), STAT_RiveAdvancedArtboardsSerial, STATGROUP_Rive, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Advanced Artboards (Parallel)"), STAT_RiveAdvancedArtboardsParallel, STATGROUP_Rive, );
+
+/** Render Targets which were up to date, so neither their draws nor their PLS flush were submitted */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Redraws"), STAT_RiveSkippedRedraws, STATGROUP_Rive, );
+
+/** Texture atlas pages redrawn this frame, each one being a single PLS flush for all of its Rive Files */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Atlas Pages Drawn"), STAT_RiveAtlasPagesDrawn, STATGROUP_Rive, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Atlas Entries Drawn"), STAT_RiveAtlasEntriesDrawn, STATGROUP_Rive, );
+
+/** Render targets of the Rive Textures currently in use */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Texture Pool (Live)"), STAT_RiveTexturePoolLiveMemory, STATGROUP_Rive, );
+
+/** Render targets kept by the texture pool for reuse, see Rive.TexturePool.MaxPooledMB */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Texture Pool (Pooled)"), STAT_RiveTexturePoolPooledMemory, STATGROUP_Rive, );
+
+/** Tickables skipped this frame as their update rate did not call for a tick */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Tickables (Update Rate)"), STAT_RiveDeferredTickables, STATGROUP_Rive, );
+
+/** Advance and render of the time-sliced tickables, bounded by Rive.Tick.TimeSliceBudgetMs */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick (Time Sliced)"), STAT_RiveTickTimeSliced, STATGROUP_Rive, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Time Sliced Tickables"), STAT_RiveTimeSlicedTickables, STATGROUP_Rive, );
+
+/** Tickables skipped this frame as nothing displayed them for Rive.Suspend.GracePeriod */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Suspended Tickables (Offscreen)"), STAT_RiveSuspendedTickables, STATGROUP_Rive, );
+
+/** rive::File::import of the Rive Files, including the decoding of their assets. Runs on worker threads with Rive.File.AsyncImport */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("File Import"), STAT_RiveFileImport, STATGROUP_Rive, );
+
+/** Time-sliced tickables which were due but did not fit in the budget, they are ticked first on the next frame */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Time Sliced Tickables (Deferred)"), STAT_RiveTimeSlicedDeferredTickables, STATGROUP_Rive, );
@@ -5,6 +5,7 @@
 #include "IRiveRenderTarget.h"
 #include "RiveTypes.h"
 #include "Components/ActorComponent.h"
+#include "Rive/RiveTickable.h"
 #include "RiveActorComponent.generated.h"
 
 class URiveTexture;
@@ -12,7 +13,7 @@ class URiveArtboard;
 class URiveFile;
 
 UCLASS(ClassGroup = (Custom), Meta = (BlueprintSpawnableComponent))
-class RIVE_API URiveActorComponent : public UActorComponent
+class RIVE_API URiveActorComponent : public UActorComponent, public IRiveTickable
 {
     DECLARE_DYNAMIC_MULTICAST_DELEGATE(FRiveReadyDelegate);
     
@@ -33,13 +34,32 @@ protected:
 
     // Called when the game starts
     virtual void BeginPlay() override;
-    
-public:
 
-    // Called every frame
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     //~ END : UActorComponent Interface
+
+    //~ BEGIN : IRiveTickable Interface
+
+public:
+
+    virtual bool IsRiveTickable() const override;
+
+    virtual void GetRiveTickArtboards(TArray<URiveArtboard*>& OutArtboards) const override;
+
+    virtual void RiveTick_Render(float InDeltaSeconds) override;
+
+    virtual ERiveUpdateRate GetRiveUpdateRate() const override { return UpdateRate; }
+
+    virtual bool HasPendingRiveUpdate() const override;
+
+    virtual bool IsRiveTimeSliced() const override { return bTimeSliced; }
+
+    virtual TOptional<double> GetRiveLastDisplayTime() const override;
+
+    virtual UWorld* GetRiveTickWorld() const override { return GetWorld(); }
+
+    //~ END : IRiveTickable Interface
     
     void InitializeRenderTarget(int32 SizeX, int32 SizeY);
 
@@ -63,6 +83,21 @@ public:
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive, meta = (ClampMin = 1, UIMin = 1, ClampMax = 3840, UIMax = 3840))
     FIntPoint Size;
     
+    /** How often the Artboards are advanced and redrawn */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    ERiveUpdateRate UpdateRate = ERiveUpdateRate::EveryFrame;
+
+    /** Low priority: when due, the update may be delayed to a later frame to keep within Rive.Tick.TimeSliceBudgetMs */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    bool bTimeSliced = false;
+
+    /**
+     * Stops advancing and drawing while neither a Rive widget nor a material displays the Render Target, see Rive.Suspend.GracePeriod.
+     * Only enable it if nothing else displays the Render Target: UMG or Slate brushes, canvas draws and custom consumers are not detected.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    bool bSuspendWhenOffscreen = false;
+
     UPROPERTY(BlueprintReadWrite, SkipSerialization, Transient, Category=Rive)
     TArray<URiveArtboard*> RenderObjects;
 
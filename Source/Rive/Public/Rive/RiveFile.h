@@ -6,8 +6,8 @@
 #include "RiveArtboard.h"
 #include "RiveEvent.h"
 #include "RiveTexture.h"
+#include "RiveTickable.h"
 #include "RiveTypes.h"
-#include "Tickable.h"
 #include "RiveFile.generated.h"
 
 #if WITH_RIVE
@@ -18,6 +18,7 @@ class FRiveTextureResource;
 
 namespace rive
 {
+	class Factory;
 	class File;
 }
 
@@ -30,7 +31,7 @@ class UUserWidget;
  *
  */
 UCLASS(BlueprintType, Blueprintable, HideCategories="ImportSettings")
-class RIVE_API URiveFile : public URiveTexture, public FTickableGameObject
+class RIVE_API URiveFile : public URiveTexture, public IRiveTickable
 {
 	GENERATED_BODY()
 
@@ -49,26 +50,24 @@ public:
 	
 	virtual void BeginDestroy() override;
 	
-	//~ BEGIN : FTickableGameObject Interface
+	//~ BEGIN : IRiveTickable Interface
 
 public:
-	virtual TStatId GetStatId() const override;
+	virtual bool IsRiveTickable() const override;
 
-	virtual void Tick(float InDeltaSeconds) override;
+	virtual void GetRiveTickArtboards(TArray<URiveArtboard*>& OutArtboards) const override;
 
-	virtual bool IsTickable() const override;
+	virtual void RiveTick_Render(float InDeltaSeconds) override;
 
-	virtual bool IsTickableInEditor() const override
-	{
-		return true;
-	}
+	virtual ERiveUpdateRate GetRiveUpdateRate() const override { return UpdateRate; }
 
-	virtual ETickableTickType GetTickableTickType() const override
-	{
-		return ETickableTickType::Conditional;
-	}
+	virtual bool HasPendingRiveUpdate() const override;
 
-	//~ END : FTickableGameObject Interface
+	virtual bool IsRiveTimeSliced() const override { return bTimeSliced; }
+
+	virtual TOptional<double> GetRiveLastDisplayTime() const override;
+
+	//~ END : IRiveTickable Interface
 
 	//~ BEGIN : UObject Interface
 	virtual void PostLoad() override;
@@ -81,6 +80,19 @@ public:
 
 	//~ END : UObject Interface
 
+	//~ BEGIN : URiveTexture Interface
+
+public:
+	virtual URiveTexture* GetDisplayTexture(FBox2f& OutUVRect) const override;
+
+protected:
+	/** Without manual size, the render resources are only created once the Artboard gives their size */
+	virtual bool ShouldInitializeResourcesOnLoad() const override { return bManualSize; }
+
+	virtual void OnRenderResourcesChanged() override;
+
+	//~ END : URiveTexture Interface
+
 	/**
 	 * Implementation(s)
 	 */
@@ -140,6 +152,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = Rive)
 	bool IsInitialized() const { return InitState == ERiveInitState::Initialized; }
 
+	/** Returns true if this file renders in a page of the texture atlas, see GetDisplayTexture and bCopyFromTextureAtlas */
+	UFUNCTION(BlueprintPure, Category = Rive)
+	bool IsInTextureAtlas() const { return AtlasEntryHandle != INDEX_NONE; }
+
 	/**
 	 * Call the given delegate once this RiveFile has been initialized.
 	 * It is already initialized, the delegate will fire instantly.
@@ -155,6 +171,13 @@ public:
 	FRiveReadyDelegate OnRiveReady;
 private:
 	void BroadcastInitializationResult(bool bSuccess);
+#if WITH_RIVE
+	/** Imports a copy of RiveNativeFileSpan and of the asset bytes on a worker thread, the result is published on the Game Thread by OnNativeFileImported */
+	void ImportNativeFileAsync(rive::Factory* InRiveFactory);
+	void OnNativeFileImported(std::unique_ptr<rive::File>&& InNativeFile);
+#endif // WITH_RIVE
+	/** Instances the Artboard once the native file is available and broadcasts the initialization result */
+	void FinishInitialization();
 	TOptional<bool> WasLastInitializationSuccessful{};
 	FOnRiveFileInitialized OnInitializedOnceDelegate;
 	
@@ -244,10 +267,40 @@ private:
 	UPROPERTY(EditAnywhere, Category = Rive)
 	bool bIsRendering = true;
 
+	/** How often the Artboard is advanced and redrawn, background or decorative files rarely need every frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive, meta = (AllowPrivateAccess))
+	ERiveUpdateRate UpdateRate = ERiveUpdateRate::EveryFrame;
+
+	/** Low priority: when due, the update may be delayed to a later frame to keep within Rive.Tick.TimeSliceBudgetMs */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive, meta = (AllowPrivateAccess))
+	bool bTimeSliced = false;
+
+	/**
+	 * Stops advancing and drawing while neither a Rive widget nor a material displays this texture, see Rive.Suspend.GracePeriod.
+	 * Only enable it if nothing else displays the texture: UMG or Slate brushes, canvas draws and custom consumers are not detected.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive, meta = (AllowPrivateAccess))
+	bool bSuspendWhenOffscreen = false;
+
 	/** Control Size of Render Texture Manually */
 	UPROPERTY(EditAnywhere, Category = Rive)
 	bool bManualSize = false;
 
+	/**
+	 * Render in a page of the texture atlas shared with the other small Rive Files, all the files of a page being drawn in a single PLS flush.
+	 * Only the files up to Rive.Atlas.MaxEntrySize are packed. This texture then has no resource of its own: the Rive widgets sample the page,
+	 * materials and brushes get it with its UV rect from MakeDisplayBrush or SetDisplayTextureParameters, see bCopyFromTextureAtlas otherwise
+	 */
+	UPROPERTY(EditAnywhere, Category = Rive)
+	bool bUseTextureAtlas = false;
+
+	/**
+	 * Keep a texture of its own while in the texture atlas, each redraw being copied to it from the page. Only needed by the materials and brushes
+	 * referencing this file directly instead of through its display texture, as it costs the full texture and a GPU copy per redraw
+	 */
+	UPROPERTY(EditAnywhere, Category = Rive, meta = (EditCondition = "bUseTextureAtlas"))
+	bool bCopyFromTextureAtlas = false;
+
 	UPROPERTY(EditAnywhere, Category=Rive)
 	TSubclassOf<UUserWidget> WidgetClass;
 
@@ -256,6 +309,11 @@ private:
 
 	UE::Rive::Renderer::IRiveRenderTargetPtr RiveRenderTarget;
 
+	/** Handle of our entry in the texture atlas, INDEX_NONE when rendering to our own texture */
+	int32 AtlasEntryHandle = INDEX_NONE;
+
+	void ReleaseAtlasEntry();
+
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category=Rive, meta=(NoResetToDefault, AllowPrivateAccess, ShowInnerProperties))
 	URiveArtboard* Artboard = nullptr;
 
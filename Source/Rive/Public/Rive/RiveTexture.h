@@ -5,10 +5,13 @@
 #include "CoreMinimal.h"
 #include "RiveArtboard.h"
 #include "Engine/Texture2DDynamic.h"
+#include "Misc/App.h"
+#include "Styling/SlateBrush.h"
 #include "RiveTexture.generated.h"
 
 class URiveArtboard;
 class FRiveTextureResource;
+class UMaterialInstanceDynamic;
 
 #define RIVE_MIN_TEX_RESOLUTION 1
 #define RIVE_MAX_TEX_RESOLUTION 3840
@@ -46,6 +49,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Rive)
 	virtual void ResizeRenderTargets(const FIntPoint InNewSize);
 	
+	/**
+	 * Returns the texture holding the rendered content and the UV rect to sample it with, which is this texture as a whole
+	 * unless the content is rendered in a page of the texture atlas
+	 */
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	virtual URiveTexture* GetDisplayTexture(FBox2f& OutUVRect) const;
+
+	/** Returns a brush sampling the display texture with its UV rect, to be made again once the Artboard changed, see GetDisplayTexture */
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	FSlateBrush MakeDisplayBrush() const;
+
+	/**
+	 * Sets the display texture and its UV rect, as (MinU, MinV, MaxU, MaxV), on the given material parameters.
+	 * The material samples the texture at lerp(UVRect.xy, UVRect.zw, UV). To be set again once the Artboard changed, see GetDisplayTexture
+	 */
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	void SetDisplayTextureParameters(UMaterialInstanceDynamic* InMaterial, FName InTextureParameterName, FName InUVRectParameterName) const;
+
+	/** To be called each frame by whatever displays this texture other than through a material, so its Rive File is not suspended as offscreen */
+	void MarkDisplayed() { LastDisplayTime = FApp::GetCurrentTime(); }
+
+	/** Returns the last time, in FApp::GetCurrentTime, this texture was painted by a Rive widget or sampled by a material */
+	double GetLastDisplayTime() const;
+
 	FVector2f GetLocalCoordinatesFromExtents(URiveArtboard* InArtboard, const FVector2f& InPosition, const FBox2f& InExtents) const;
 
 	ESimpleElementBlendMode GetSimpleElementBlendMode() const;
@@ -58,6 +85,15 @@ protected:
 	 */
 	void InitializeResources() const;
 
+	/** Returns false to only create the render resources on the first ResizeRenderTargets, when the serialized Size is not the final one */
+	virtual bool ShouldInitializeResourcesOnLoad() const { return true; }
+
+	/** Called on the Game Thread when the render resources are created again, even at the same size, their previous content is lost */
+	virtual void OnRenderResourcesChanged() {}
+
+	/** Releases the render resources but keeps the given Size, for content only displayed through another texture, see GetDisplayTexture */
+	void ReleaseRenderTargets(const FIntPoint InSize);
+
 	/**
 	 * Resize render resources
 	 */
@@ -72,4 +108,6 @@ protected:
 
 	UPROPERTY(EditAnywhere, Category = Rive)
 	ERiveBlendMode RiveBlendMode = ERiveBlendMode::SE_BLEND_AlphaComposite;
+
+	double LastDisplayTime = -DBL_MAX;
 };
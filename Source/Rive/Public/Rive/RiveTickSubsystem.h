@@ -0,0 +1,128 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "Subsystems/EngineSubsystem.h"
+#include "Tickable.h"
+#include "RiveTickSubsystem.generated.h"
+
+class IRiveTickable;
+class URiveArtboard;
+class URiveTextureAtlas;
+
+/**
+ * Ticks every registered IRiveTickable at its update rate: the independent State Machines are advanced with ParallelFor,
+ * then the draws are recorded and submitted to the Render Thread as a single batch. The time-sliced tickables are ticked last, serially,
+ * within a per frame budget.
+ */
+UCLASS()
+class RIVE_API URiveTickSubsystem : public UEngineSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+	//~ BEGIN : USubsystem Interface
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	//~ END : USubsystem Interface
+
+	//~ BEGIN : FTickableGameObject Interface
+
+public:
+
+	virtual TStatId GetStatId() const override;
+
+	virtual void Tick(float InDeltaSeconds) override;
+
+	virtual bool IsTickable() const override
+	{
+		return bIsInitialized;
+	}
+
+	virtual bool IsTickableInEditor() const override
+	{
+		return true;
+	}
+
+	virtual ETickableTickType GetTickableTickType() const override
+	{
+		return ETickableTickType::Conditional;
+	}
+
+	//~ END : FTickableGameObject Interface
+
+	/**
+	 * Implementation(s)
+	 */
+
+public:
+
+	/** Registers the tickable until UnregisterTickable is called, it must be unregistered before being destroyed */
+	static void RegisterTickable(IRiveTickable* InTickable);
+
+	static void UnregisterTickable(IRiveTickable* InTickable);
+
+	/** Returns the texture atlas the Rive Files opting in are packed in, nullptr if the subsystem is not initialized */
+	static URiveTextureAtlas* GetTextureAtlas();
+
+	/**
+	 * Attribute(s)
+	 */
+
+private:
+
+	struct FRegisteredTickable
+	{
+		IRiveTickable* Tickable = nullptr;
+
+		/** Time elapsed since its last tick, given as delta time to the next one */
+		float AccumulatedDeltaSeconds = 0.f;
+
+		/** Counts as its first display time, so a new tickable gets the grace period to be displayed */
+		double RegisteredTime = 0.0;
+	};
+
+	struct FFrameTickable
+	{
+		IRiveTickable* Tickable = nullptr;
+
+		float DeltaSeconds = 0.f;
+
+		/** Index in Tickables when the frame started, used as round-robin position by the time-sliced tickables */
+		int32 TickableIndex = INDEX_NONE;
+	};
+
+	/** Returns true if nothing displayed the tickable for longer than Rive.Suspend.GracePeriod */
+	static bool IsSuspended(const FRegisteredTickable& InRegisteredTickable, double InCurrentTime);
+
+	/** Returns true if the update rate of the tickable calls for a tick this frame */
+	static bool IsTickDue(const FRegisteredTickable& InRegisteredTickable, float InDeltaSeconds);
+
+	/** Advances and renders the time-sliced tickables due this frame in round-robin, until Rive.Tick.TimeSliceBudgetMs is spent */
+	void TickTimeSliced();
+
+	static TArray<FRegisteredTickable> Tickables;
+
+	/** Tickables of the current frame, an entry is nulled if it gets unregistered while ticking */
+	static TArray<FFrameTickable> FrameTickables;
+
+	static TArray<FFrameTickable> FrameTimeSlicedTickables;
+
+	/** Per frame scratch arrays, kept to avoid reallocating them each frame */
+	TArray<URiveArtboard*> FrameArtboards;
+
+	TArray<TPair<URiveArtboard*, float>> ParallelArtboards;
+
+	/** Index in Tickables from which the next time-sliced tickables get ticked */
+	int32 TimeSliceCursor = 0;
+
+	/** Its pages are submitted at the end of the render batch, once all the tickables submitted the draws of their atlas entries */
+	UPROPERTY(Transient)
+	TObjectPtr<URiveTextureAtlas> TextureAtlas;
+
+	bool bIsInitialized = false;
+};
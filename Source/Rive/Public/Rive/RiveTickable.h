@@ -0,0 +1,60 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RiveTypes.h"
+
+class URiveArtboard;
+class UWorld;
+
+/**
+ * Object ticked by the URiveTickSubsystem. Each frame, the State Machines of the Artboards it returns are advanced first,
+ * in parallel when possible, and only then is it asked to record and submit its draws.
+ */
+class RIVE_API IRiveTickable
+{
+	/**
+	 * Structor(s)
+	 */
+
+public:
+
+	virtual ~IRiveTickable() = default;
+
+	/**
+	 * Implementation(s)
+	 */
+
+public:
+
+	/** Returns true if this should be ticked this frame */
+	virtual bool IsRiveTickable() const = 0;
+
+	/** Appends the Artboards whose State Machine should be advanced this frame */
+	virtual void GetRiveTickArtboards(TArray<URiveArtboard*>& OutArtboards) const = 0;
+
+	/** Called on the Game Thread once all the Artboards of this frame got advanced, to record and submit the draws */
+	virtual void RiveTick_Render(float InDeltaSeconds) = 0;
+
+	/** Returns how often this should be ticked, the delta time of a tick being the time accumulated since the previous one */
+	virtual ERiveUpdateRate GetRiveUpdateRate() const { return ERiveUpdateRate::EveryFrame; }
+
+	/** With the OnDemand update rate, returns true if this should be ticked this frame */
+	virtual bool HasPendingRiveUpdate() const { return true; }
+
+	/** Returns true if this is low priority, its ticks are then spread across frames by the Rive.Tick.TimeSliceBudgetMs budget */
+	virtual bool IsRiveTimeSliced() const { return false; }
+
+	/**
+	 * Returns the last time, in FApp::GetCurrentTime, the output of this was displayed. Once nothing displayed it for Rive.Suspend.GracePeriod,
+	 * it is suspended until it is displayed again. Returns an unset value to never be suspended.
+	 */
+	virtual TOptional<double> GetRiveLastDisplayTime() const { return {}; }
+
+	/**
+	 * Returns the World this belongs to, if any. Like a component tick, this is then not ticked while its World is paused,
+	 * and its delta time is the one of its World, time dilation included.
+	 */
+	virtual UWorld* GetRiveTickWorld() const { return nullptr; }
+};
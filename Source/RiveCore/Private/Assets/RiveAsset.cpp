@@ -22,46 +22,57 @@ void URiveAsset::LoadFromDisk()
 
 bool URiveAsset::DecodeNativeAsset(rive::FileAsset& InAsset, rive::Factory* InRiveFactory, const rive::Span<const uint8>& AssetBytes)
 {
-	switch(Type)
+	if (!DecodeNativeAsset(InAsset, InRiveFactory, AssetBytes, Name))
+	{
+		return false;
+	}
+
+	NativeAsset = &InAsset;
+	return true;
+}
+
+bool URiveAsset::DecodeNativeAsset(rive::FileAsset& InAsset, rive::Factory* InRiveFactory, const rive::Span<const uint8>& AssetBytes, const FString& InName)
+{
+	switch(static_cast<ERiveAssetType>(InAsset.coreType()))
 	{
 	case ERiveAssetType::Font:
-		return DecodeFontAsset(InAsset, InRiveFactory, AssetBytes);
+		return DecodeFontAsset(InAsset, InRiveFactory, AssetBytes, InName);
 	case ERiveAssetType::Image:
-		return DecodeImageAsset(InAsset, InRiveFactory, AssetBytes);
+		return DecodeImageAsset(InAsset, InRiveFactory, AssetBytes, InName);
 	}
 
 	return false;
 }
 
-bool URiveAsset::DecodeImageAsset(rive::FileAsset& InAsset, rive::Factory* InRiveFactory, const rive::Span<const uint8>& AssetBytes)
+bool URiveAsset::DecodeImageAsset(rive::FileAsset& InAsset, rive::Factory* InRiveFactory, const rive::Span<const uint8>& AssetBytes, const FString& InName)
 {
+	// Images stay encoded until here, even in cooked builds: the PLSRenderContext only creates its image textures from encoded bytes,
+	// and only the GL backend can adopt an existing texture, whose ownership it then takes. A cooked UTexture2D can't back a rive::RenderImage
 	rive::rcp<rive::RenderImage> DecodedImage = InRiveFactory->decodeImage(AssetBytes);
 
 	if (DecodedImage == nullptr)
 	{
-		UE_LOG(LogRiveCore, Error, TEXT("Could not decode image asset: %s"), *Name);
+		UE_LOG(LogRiveCore, Error, TEXT("Could not decode image asset: %s"), *InName);
 		return false;
 	}
 
 	rive::ImageAsset* ImageAsset = InAsset.as<rive::ImageAsset>();
 	ImageAsset->renderImage(DecodedImage);
-	NativeAsset = ImageAsset;
 	return true;
 }
 
 bool URiveAsset::DecodeFontAsset(rive::FileAsset& InAsset, rive::Factory* InRiveFactory,
-	const rive::Span<const uint8>& AssetBytes)
+	const rive::Span<const uint8>& AssetBytes, const FString& InName)
 {
 	rive::rcp<rive::Font> DecodedFont = InRiveFactory->decodeFont(AssetBytes);
 
 	if (DecodedFont == nullptr)
 	{
-		UE_LOG(LogRiveCore, Error, TEXT("Could not decode font asset: %s"), *Name);
+		UE_LOG(LogRiveCore, Error, TEXT("Could not decode font asset: %s"), *InName);
 		return false;
 	}
 
 	rive::FontAsset* FontAsset = InAsset.as<rive::FontAsset>();
 	FontAsset->font(DecodedFont);
-	NativeAsset = FontAsset;
 	return true;
 }
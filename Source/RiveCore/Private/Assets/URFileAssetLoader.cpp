@@ -2,6 +2,8 @@
 
 #include "Assets/URFileAssetLoader.h"
 #include "Assets/RiveAsset.h"
+#include "Assets/URAssetImporter.h"
+#include "Async/ParallelFor.h"
 #include "Logs/RiveCoreLog.h"
 #include "rive/factory.hpp"
 
@@ -14,8 +16,8 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 
-UE::Rive::Assets::FURFileAssetLoader::FURFileAssetLoader(UObject* InOuter, TMap<uint32, TObjectPtr<URiveAsset>>& InAssets)
-	: Outer(InOuter), Assets(InAssets)
+UE::Rive::Assets::FURFileAssetLoader::FURFileAssetLoader(UObject* InOuter, TMap<uint32, TObjectPtr<URiveAsset>>& InAssets, FURAssetImporter* InAssetImporter)
+	: Outer(InOuter), Assets(InAssets), AssetImporter(InAssetImporter)
 {
 }
 
@@ -30,7 +32,12 @@ bool UE::Rive::Assets::FURFileAssetLoader::loadContents(rive::FileAsset& InAsset
 		return true;
 	}
 	
-	const rive::Span<const uint8>* AssetBytes = &InBandBytes;
+	// Creates the URiveAsset of the OOB assets while the file is traversed, instead of an import pass of its own
+	if (AssetImporter && !AssetImporter->loadContents(InAsset, InBandBytes, InFactory))
+	{
+		return false;
+	}
+	
 	const bool bUseInBand = InBandBytes.size() > 0;
 	
 	// We can take two paths here
@@ -38,43 +45,103 @@ bool UE::Rive::Assets::FURFileAssetLoader::loadContents(rive::FileAsset& InAsset
 	// 2. Or use InBandbytes if no other options are found to load
 	// Unity version prefers disk assets, over InBand, if they exist, allowing overrides
 	
-	URiveAsset* RiveAsset = nullptr;
-	const TObjectPtr<URiveAsset>* RiveAssetPtr = Assets.Find(InAsset.assetId());
-	if (RiveAssetPtr == nullptr)
+	const TArray<uint8>* AssetBytes = nullptr;
+	if (CopiedAssetBytes.IsSet())
+	{
+		AssetBytes = CopiedAssetBytes->Find(InAsset.assetId());
+	}
+	else if (const TObjectPtr<URiveAsset>* RiveAssetPtr = Assets.Find(InAsset.assetId()))
+	{
+		AssetBytes = &(*RiveAssetPtr)->NativeAssetBytes;
+	}
+	
+	if (AssetBytes == nullptr)
 	{
 		if (!bUseInBand)
 		{
 			UE_LOG(LogRiveCore, Error, TEXT("Could not find pre-loaded asset. This means the initial import probably failed."));
 			return false;
 		}
-		
-		RiveAsset = NewObject<URiveAsset>(Outer, URiveAsset::StaticClass(),
-			MakeUniqueObjectName(Outer, URiveAsset::StaticClass(), FName{FString::Printf(TEXT("%d"),InAsset.assetId())}),
-			RF_Transient);
+	}
+	else if (!bUseInBand && AssetBytes->IsEmpty())
+	{
+		UE_LOG(LogRiveCore, Error, TEXT("Trying to load out of band asset, but its bytes were never filled."));
+		return false;
+	}
 
-		RiveAsset->Id = InAsset.assetId();
-		RiveAsset->Name = FString(UTF8_TO_TCHAR(InAsset.name().c_str()));
-		RiveAsset->Type = static_cast<ERiveAssetType>(InAsset.coreType());
-		RiveAsset->bIsInBand = true;
+	// Other assets, like audio, are left to the runtime
+	const ERiveAssetType AssetType = static_cast<ERiveAssetType>(InAsset.coreType());
+	if (AssetType != ERiveAssetType::Image && AssetType != ERiveAssetType::Font)
+	{
+		return false;
 	}
-	else
+
+	// The asset is only decoded by DecodeGatheredAssets, the file keeps traversing meanwhile
+	FGatheredAsset& GatheredAsset = GatheredAssets.AddDefaulted_GetRef();
+	GatheredAsset.NativeAsset = &InAsset;
+	GatheredAsset.Factory = InFactory;
+	GatheredAsset.bHasRiveAsset = AssetBytes != nullptr;
+	GatheredAsset.AssetBytes = AssetBytes;
+	if (bUseInBand)
 	{
-		RiveAsset = RiveAssetPtr->Get();
+		GatheredAsset.InBandBytes.Append(InBandBytes.data(), static_cast<int32>(InBandBytes.size()));
 	}
+	return true;
+}
+
+void UE::Rive::Assets::FURFileAssetLoader::CopyAssetBytes()
+{
+	check(IsInGameThread());
+	check(!AssetImporter);
 
-	rive::Span<const uint8> OutOfBandBytes;
-	if (!bUseInBand)
+	CopiedAssetBytes.Emplace();
+	CopiedAssetBytes->Reserve(Assets.Num());
+	for (const TPair<uint32, TObjectPtr<URiveAsset>>& Asset : Assets)
 	{
-		if (RiveAsset->NativeAssetBytes.IsEmpty())
+		if (Asset.Value)
 		{
-			UE_LOG(LogRiveCore, Error, TEXT("Trying to load out of band asset, but its bytes were never filled."));
-			return false;
+			CopiedAssetBytes->Add(Asset.Key, Asset.Value->NativeAssetBytes);
 		}
-		OutOfBandBytes = rive::make_span(RiveAsset->NativeAssetBytes.GetData(), RiveAsset->NativeAssetBytes.Num());
-		AssetBytes = &OutOfBandBytes;
 	}
+}
 
-	return RiveAsset->DecodeNativeAsset(InAsset, InFactory, *AssetBytes);
+void UE::Rive::Assets::FURFileAssetLoader::DecodeGatheredAssets()
+{
+	// Fonts are parsed and images decoded in parallel, the factory only takes the lock of the renderer to upload the decoded pixels.
+	// Only the static decoding is used, the URiveAssets are left to PublishDecodedAssets so no UObject is written from the workers
+	ParallelFor(GatheredAssets.Num(), [this](int32 AssetIndex)
+	{
+		FGatheredAsset& GatheredAsset = GatheredAssets[AssetIndex];
+		
+		const TArray<uint8>& AssetBytes = GatheredAsset.InBandBytes.IsEmpty() ? *GatheredAsset.AssetBytes : GatheredAsset.InBandBytes;
+		GatheredAsset.bIsDecoded = URiveAsset::DecodeNativeAsset(*GatheredAsset.NativeAsset, GatheredAsset.Factory,
+			rive::make_span(AssetBytes.GetData(), AssetBytes.Num()),
+			FString(UTF8_TO_TCHAR(GatheredAsset.NativeAsset->name().c_str())));
+	}, GatheredAssets.Num() == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	
+	for (const FGatheredAsset& GatheredAsset : GatheredAssets)
+	{
+		if (GatheredAsset.bHasRiveAsset && GatheredAsset.bIsDecoded)
+		{
+			DecodedAssets.Emplace(GatheredAsset.NativeAsset->assetId(), GatheredAsset.NativeAsset);
+		}
+	}
+	GatheredAssets.Empty();
+	CopiedAssetBytes.Reset();
+}
+
+void UE::Rive::Assets::FURFileAssetLoader::PublishDecodedAssets()
+{
+	check(IsInGameThread());
+
+	for (const TPair<uint32, rive::FileAsset*>& DecodedAsset : DecodedAssets)
+	{
+		if (const TObjectPtr<URiveAsset>* RiveAsset = Assets.Find(DecodedAsset.Key); RiveAsset && *RiveAsset)
+		{
+			(*RiveAsset)->NativeAsset = DecodedAsset.Value;
+		}
+	}
+	DecodedAssets.Empty();
 }
 
 #endif // WITH_RIVE
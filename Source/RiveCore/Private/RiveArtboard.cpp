@@ -5,7 +5,10 @@
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
 #include "RiveEvent.h"
+#include "HAL/IConsoleManager.h"
+#include "RiveScopeLock.h"
 #include "Logs/RiveCoreLog.h"
+#include "Stats/RiveCoreStats.h"
 #include "URStateMachine.h"
 
 #if WITH_RIVE
@@ -16,40 +19,121 @@ THIRD_PARTY_INCLUDES_START
 #include "rive/generated/animation/state_machine_bool_base.hpp"
 #include "rive/generated/animation/state_machine_number_base.hpp"
 #include "rive/generated/animation/state_machine_trigger_base.hpp"
+#include "rive/text/text_value_run.hpp"
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 
 #if WITH_RIVE
 
+static TAutoConsoleVariable<bool> CVarRiveArtboardUseRendererLock(
+	TEXT("Rive.Artboard.UseRendererLock"),
+	false,
+	TEXT("If true, newly initialized Artboards synchronize on the renderer-wide lock instead of their own lock.\n")
+	TEXT("Only meant to compare the lock wait stats (stat RiveCore, stat RiveRenderer) against the previous behaviour."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarRiveArtboardSkipSettled(
+	TEXT("Rive.Artboard.SkipSettled"),
+	true,
+	TEXT("If true, Artboards whose State Machine settled and did not receive any input are neither advanced nor redrawn, their Render Target keeps its previous content."),
+	ECVF_Default);
+
+/** Counts a handle Setter as writing into the slot set it loads, which is not freed until the write is done, see URiveArtboard::FreeRetiredInputSlotSets */
+struct FRiveInputSlotWriteScope
+{
+	explicit FRiveInputSlotWriteScope(std::atomic<uint32>& InNumWriters)
+		: NumWriters(InNumWriters)
+	{
+		NumWriters.fetch_add(1, std::memory_order_seq_cst);
+	}
+
+	~FRiveInputSlotWriteScope()
+	{
+		NumWriters.fetch_sub(1, std::memory_order_release);
+	}
+
+	std::atomic<uint32>& NumWriters;
+};
+
 void URiveArtboard::BeginDestroy()
 {
 	bIsInitialized = false;
 
-	DefaultStateMachinePtr.Reset();
-	if (NativeArtboardPtr != nullptr)
 	{
-		NativeArtboardPtr.release();
+		UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+		DefaultStateMachinePtr.Reset();
+		if (NativeArtboardPtr != nullptr)
+		{
+			NativeArtboardPtr.release();
+		}
+		NativeArtboardPtr.reset();
 	}
-	NativeArtboardPtr.reset();
 	OnArtboardTick_Render.Clear();
 	OnArtboardTick_StateMachine.Clear();
+
+	// No fence needed, the draw snapshots in flight own everything the Render Thread replays
 	UObject::BeginDestroy();
 }
 
 void URiveArtboard::AdvanceStateMachine(float InDeltaSeconds)
 {
+	if (PreAdvanceStateMachine_GameThread())
+	{
+		AdvanceStateMachine_AnyThread(InDeltaSeconds);
+	}
+}
+
+bool URiveArtboard::PreAdvanceStateMachine_GameThread()
+{
+	check(IsInGameThread());
+	
 	UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine();
 	if (StateMachine && StateMachine->IsValid() && ensure(RiveRenderTarget))
 	{
 		if (!bIsReceivingInput)
 		{
-			if (StateMachine->HasAnyReportedEvents())
+			if (bHasUnreportedEvents.exchange(false))
 			{
 				PopulateReportedEvents();
 			}
-			StateMachine->Advance(InDeltaSeconds);
+
+			if (CVarRiveArtboardSkipSettled.GetValueOnGameThread() && !HasPendingStateMachineChanges())
+			{
+				INC_DWORD_STAT(STAT_RiveCoreSkippedAdvances);
+				return false;
+			}
+			return true;
 		}
 	}
+	return false;
+}
+
+void URiveArtboard::AdvanceStateMachine_AnyThread(float InDeltaSeconds)
+{
+	if (UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
+	{
+		UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+		ApplyPendingInputCommands();
+		bIsSettled = !StateMachine->Advance(InDeltaSeconds);
+		bHasUnreportedEvents = StateMachine->HasAnyReportedEvents();
+		bNeedsRedraw = true;
+	}
+}
+
+bool URiveArtboard::NeedsRedraw() const
+{
+	return bNeedsRedraw || OnArtboardTick_Render.IsBound() || !CVarRiveArtboardSkipSettled.GetValueOnGameThread();
+}
+
+bool URiveArtboard::HasPendingStateMachineChanges() const
+{
+	if (!bIsSettled || bHasPendingInputSlots.load(std::memory_order_acquire) || !PendingInputCommands.IsEmpty())
+	{
+		return true;
+	}
+
+	const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine();
+	return StateMachine && StateMachine->HasPendingInteraction();
 }
 
 void URiveArtboard::Transform(const FVector2f& One, const FVector2f& Two, const FVector2f& T)
@@ -105,63 +189,84 @@ void URiveArtboard::Draw()
 	{
 		return;
 	}
-	RiveRenderTarget->Draw(GetNativeArtboard());
+	RiveRenderTarget->Draw(GetNativeArtboard(), ArtboardCSPtr);
 	LastDrawTransform = GetTransformMatrix();
+	bNeedsRedraw = false;
 }
 
-void URiveArtboard::FireTrigger(const FString& InPropertyName) const
+void URiveArtboard::Save()
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (ensure(RiveRenderer))
+	if (!RiveRenderTarget)
 	{
-		FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-		if (const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
-		{
-			StateMachine->FireTrigger(InPropertyName);
-		}
+		return;
+	}
+	RiveRenderTarget->Save();
+}
+
+void URiveArtboard::Restore()
+{
+	if (!RiveRenderTarget)
+	{
+		return;
+	}
+	RiveRenderTarget->Restore();
+}
+
+void URiveArtboard::DrawPath(rive::RenderPath* InPath, rive::RenderPaint* InPaint)
+{
+	if (!RiveRenderTarget)
+	{
+		return;
+	}
+	RiveRenderTarget->DrawPath(InPath, InPaint);
+}
+
+void URiveArtboard::ClipPath(rive::RenderPath* InPath)
+{
+	if (!RiveRenderTarget)
+	{
+		return;
 	}
+	RiveRenderTarget->ClipPath(InPath);
+}
+
+void URiveArtboard::RequestRedraw()
+{
+	bIsSettled = false;
+	bNeedsRedraw = true;
+}
+
+void URiveArtboard::FireTrigger(const FString& InPropertyName) const
+{
+	EnqueueInputCommand(UE::Rive::Core::FURInputCommand(UE::Rive::Core::FURInputCommand::EType::Trigger, InPropertyName));
 }
 
 bool URiveArtboard::GetBoolValue(const FString& InPropertyName) const
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (ensure(RiveRenderer))
+	if (const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
 	{
-		FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-		if (const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
-		{
-			return StateMachine->GetBoolValue(InPropertyName);
-		}
+		return StateMachine->GetBoolValue(InPropertyName);
 	}
 	return false;
 }
 
 float URiveArtboard::GetNumberValue(const FString& InPropertyName) const
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (ensure(RiveRenderer))
+	if (const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
 	{
-		FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-		if (const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
-		{
-			return StateMachine->GetNumberValue(InPropertyName);
-		}
+		return StateMachine->GetNumberValue(InPropertyName);
 	}
 	return 0.f;
 }
 
 FString URiveArtboard::GetTextValue(const FString& InPropertyName) const
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (ensure(RiveRenderer))
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+	if (const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
 	{
-		FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-		if (const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
+		if (const rive::TextValueRunBase* TextValueRun = NativeArtboardPtr->find<rive::TextValueRunBase>(TCHAR_TO_UTF8(*InPropertyName)))
 		{
-			if (const rive::TextValueRunBase* TextValueRun = NativeArtboardPtr->find<rive::TextValueRunBase>(TCHAR_TO_UTF8(*InPropertyName)))
-			{
-				return FString{TextValueRun->text().c_str()};
-			}
+			return FString{TextValueRun->text().c_str()};
 		}
 	}
 	return {};
@@ -169,46 +274,146 @@ FString URiveArtboard::GetTextValue(const FString& InPropertyName) const
 
 void URiveArtboard::SetBoolValue(const FString& InPropertyName, bool bNewValue)
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (ensure(RiveRenderer))
+	UE::Rive::Core::FURInputCommand InputCommand(UE::Rive::Core::FURInputCommand::EType::Bool, InPropertyName);
+	InputCommand.bBoolValue = bNewValue;
+	EnqueueInputCommand(MoveTemp(InputCommand));
+}
+
+void URiveArtboard::SetNumberValue(const FString& InPropertyName, float NewValue)
+{
+	UE::Rive::Core::FURInputCommand InputCommand(UE::Rive::Core::FURInputCommand::EType::Number, InPropertyName);
+	InputCommand.NumberValue = NewValue;
+	EnqueueInputCommand(MoveTemp(InputCommand));
+}
+
+void URiveArtboard::SetTextValue(const FString& InPropertyName, const FString& NewValue)
+{
+	UE::Rive::Core::FURInputCommand InputCommand(UE::Rive::Core::FURInputCommand::EType::Text, InPropertyName);
+	InputCommand.TextValue = NewValue;
+	EnqueueInputCommand(MoveTemp(InputCommand));
+}
+
+FRiveInputHandle URiveArtboard::ResolveInput(const FString& InInputName) const
+{
+	FRiveInputHandle Handle;
+	
+	const FTCHARToUTF8 InputName(*InInputName);
+	// Locked, so neither the slot set nor its native inputs can be released by a re-initialization meanwhile
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+	if (const UE::Rive::Core::FURInputSlotSet* SlotSet = InputSlotSet.load(std::memory_order_acquire))
 	{
-		FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-		if (UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
+		for (int32 SlotIndex = 0; SlotIndex < SlotSet->Num; ++SlotIndex)
 		{
-			StateMachine->SetBoolValue(InPropertyName, bNewValue);
+			const rive::SMIInput* NativeInput = SlotSet->Slots[SlotIndex].NativeInput;
+			if (NativeInput && NativeInput->name() == InputName.Get())
+			{
+				Handle.Index = SlotIndex;
+				Handle.Generation = SlotSet->Generation;
+				return Handle;
+			}
 		}
 	}
+	
+	UE_LOG(LogRiveCore, Error, TEXT("Could not resolve the input with given name '%s' for Artboard '%s' as we could not find it."), *InInputName, *GetArtboardName());
+	return Handle;
 }
 
-void URiveArtboard::SetNumberValue(const FString& InPropertyName, float NewValue)
+FRiveTextRunHandle URiveArtboard::ResolveTextRun(const FString& InTextRunName) const
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (ensure(RiveRenderer))
+	FRiveTextRunHandle Handle;
+	
+	const FTCHARToUTF8 TextRunName(*InTextRunName);
+	for (int32 TextRunIndex = 0; TextRunIndex < TextRuns.Num(); ++TextRunIndex)
 	{
-		FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-		if (UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
+		if (TextRuns[TextRunIndex]->name() == TextRunName.Get())
 		{
-			StateMachine->SetNumberValue(InPropertyName, NewValue);
+			Handle.Index = TextRunIndex;
+			Handle.Generation = InitializationCount;
+			return Handle;
 		}
 	}
+	
+	UE_LOG(LogRiveCore, Error, TEXT("Could not resolve the text run with given name '%s' for Artboard '%s' as we could not find it."), *InTextRunName, *GetArtboardName());
+	return Handle;
 }
 
-void URiveArtboard::SetTextValue(const FString& InPropertyName, const FString& NewValue)
+void URiveArtboard::FireTriggerByHandle(const FRiveInputHandle& InHandle) const
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (ensure(RiveRenderer))
+	FRiveInputSlotWriteScope WriteScope(NumInputSlotWriters);
+	if (UE::Rive::Core::FURInputSlot* InputSlot = GetInputSlot(InHandle, UE::Rive::Core::FURInputCommand::EType::Trigger))
 	{
-		FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-		if (const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
-		{
-			if (rive::TextValueRunBase* TextValueRun = NativeArtboardPtr->find<rive::TextValueRunBase>(TCHAR_TO_UTF8(*InPropertyName)))
-			{
-				TextValueRun->text(TCHAR_TO_UTF8(*NewValue));
-			}
-		}
+		InputSlot->PendingSequence.store(InputSequence.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+		InputSlot->PendingTriggerCount.fetch_add(1, std::memory_order_release);
+		bHasPendingInputSlots.store(true, std::memory_order_release);
 	}
 }
 
+void URiveArtboard::SetBoolValueByHandle(const FRiveInputHandle& InHandle, bool bNewValue)
+{
+	FRiveInputSlotWriteScope WriteScope(NumInputSlotWriters);
+	if (UE::Rive::Core::FURInputSlot* InputSlot = GetInputSlot(InHandle, UE::Rive::Core::FURInputCommand::EType::Bool))
+	{
+		InputSlot->PendingSequence.store(InputSequence.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+		InputSlot->PendingValue.store(bNewValue ? 1.f : 0.f, std::memory_order_relaxed);
+		InputSlot->bHasPendingValue.store(true, std::memory_order_release);
+		bHasPendingInputSlots.store(true, std::memory_order_release);
+	}
+}
+
+void URiveArtboard::SetNumberValueByHandle(const FRiveInputHandle& InHandle, float NewValue)
+{
+	FRiveInputSlotWriteScope WriteScope(NumInputSlotWriters);
+	if (UE::Rive::Core::FURInputSlot* InputSlot = GetInputSlot(InHandle, UE::Rive::Core::FURInputCommand::EType::Number))
+	{
+		InputSlot->PendingSequence.store(InputSequence.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+		InputSlot->PendingValue.store(NewValue, std::memory_order_relaxed);
+		InputSlot->bHasPendingValue.store(true, std::memory_order_release);
+		bHasPendingInputSlots.store(true, std::memory_order_release);
+	}
+}
+
+void URiveArtboard::SetTextValueByHandle(const FRiveTextRunHandle& InHandle, const FString& NewValue)
+{
+	// Text has to be copied into the native run anyway, so it is applied right away rather than deferred
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+	if (rive::TextValueRunBase* TextValueRun = GetTextRun(InHandle))
+	{
+		TextValueRun->text(TCHAR_TO_UTF8(*NewValue));
+		bIsSettled = false;
+	}
+}
+
+bool URiveArtboard::GetBoolValueByHandle(const FRiveInputHandle& InHandle) const
+{
+	// Locked first, so the native input can't be released by a re-initialization once the handle got validated
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+	if (const UE::Rive::Core::FURInputSlot* InputSlot = GetInputSlot(InHandle, UE::Rive::Core::FURInputCommand::EType::Bool))
+	{
+		return static_cast<const rive::SMIBool*>(InputSlot->NativeInput)->value();
+	}
+	return false;
+}
+
+float URiveArtboard::GetNumberValueByHandle(const FRiveInputHandle& InHandle) const
+{
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+	if (const UE::Rive::Core::FURInputSlot* InputSlot = GetInputSlot(InHandle, UE::Rive::Core::FURInputCommand::EType::Number))
+	{
+		return static_cast<const rive::SMINumber*>(InputSlot->NativeInput)->value();
+	}
+	return 0.f;
+}
+
+FString URiveArtboard::GetTextValueByHandle(const FRiveTextRunHandle& InHandle) const
+{
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+	if (const rive::TextValueRunBase* TextValueRun = GetTextRun(InHandle))
+	{
+		return FString{TextValueRun->text().c_str()};
+	}
+	return {};
+}
+
 bool URiveArtboard::BindNamedRiveEvent(const FString& EventName, const FRiveNamedEventDelegate& Event)
 {
 	if (EventNames.Contains(EventName))
@@ -240,6 +445,7 @@ bool URiveArtboard::UnbindNamedRiveEvent(const FString& EventName, const FRiveNa
 
 bool URiveArtboard::TriggerNamedRiveEvent(const FString& EventName, float ReportedDelaySeconds)
 {
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
 	if (NativeArtboardPtr && GetStateMachine())
 	{
 		if (rive::Component* Component = NativeArtboardPtr->find(TCHAR_TO_UTF8(*EventName)))
@@ -249,6 +455,7 @@ bool URiveArtboard::TriggerNamedRiveEvent(const FString& EventName, float Report
 				rive::Event* Event = Component->as<rive::Event>();
 				const rive::CallbackData CallbackData(GetStateMachine()->GetNativeStateMachinePtr().get(), ReportedDelaySeconds);
 				Event->trigger(CallbackData);
+				bIsSettled = false;
 				UE_LOG(LogRiveCore, Warning, TEXT("TRIGGERED event '%s' for Artboard '%s'"), *EventName, *GetArtboardName())
 				return true;
 			}
@@ -303,6 +510,7 @@ void URiveArtboard::Initialize(rive::File* InNativeFilePtr, UE::Rive::Renderer::
 		return;
 	}
 	
+	// The renderer-wide lock only guards the factory used to instance the Artboard, our own lock guards the instance itself
 	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
 
 	if (!InNativeFilePtr)
@@ -310,6 +518,11 @@ void URiveArtboard::Initialize(rive::File* InNativeFilePtr, UE::Rive::Renderer::
 		return;
 	}
 
+	if (!bIsInitialized)
+	{
+		ArtboardCSPtr = CVarRiveArtboardUseRendererLock.GetValueOnGameThread() ? &RiveRenderer->GetThreadDataCS() : &ArtboardCS;
+	}
+
 	int32 Index = InIndex;
 	if (Index >= InNativeFilePtr->artboardCount())
 	{
@@ -346,6 +559,11 @@ void URiveArtboard::Initialize(rive::File* InNativeFilePtr, UE::Rive::Renderer::
 		return;
 	}
 
+	if (!bIsInitialized)
+	{
+		ArtboardCSPtr = CVarRiveArtboardUseRendererLock.GetValueOnGameThread() ? &RiveRenderer->GetThreadDataCS() : &ArtboardCS;
+	}
+
 	rive::Artboard* NativeArtboard = nullptr;
 	
 	if (InName.IsEmpty())
@@ -402,15 +620,6 @@ void URiveArtboard::Tick(float InDeltaSeconds)
 
 rive::Artboard* URiveArtboard::GetNativeArtboard() const
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (!RiveRenderer)
-	{
-		UE_LOG(LogRiveCore, Error, TEXT("Failed to retrieve the NativeArtboard as we do not have a valid renderer."));
-		return nullptr;
-	}
-	
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-	
 	if (!NativeArtboardPtr)
 	{
 		UE_LOG(LogRiveCore, Error, TEXT("Could not retrieve artboard as we have detected an empty rive artboard."));
@@ -423,14 +632,7 @@ rive::Artboard* URiveArtboard::GetNativeArtboard() const
 
 rive::AABB URiveArtboard::GetBounds() const
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (!RiveRenderer)
-	{
-		UE_LOG(LogRiveCore, Error, TEXT("Failed to GetBounds for the Artboard as we do not have a valid renderer."));
-		return {};
-	}
-	
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
 	
 	if (!NativeArtboardPtr)
 	{
@@ -444,14 +646,7 @@ rive::AABB URiveArtboard::GetBounds() const
 
 FVector2f URiveArtboard::GetSize() const
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (!RiveRenderer)
-	{
-		UE_LOG(LogRiveCore, Error, TEXT("Failed to GetSize for the Artboard as we do not have a valid renderer."));
-		return {};
-	}
-	
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
 	
 	if (!NativeArtboardPtr)
 	{
@@ -465,15 +660,6 @@ FVector2f URiveArtboard::GetSize() const
 
 UE::Rive::Core::FURStateMachine* URiveArtboard::GetStateMachine() const
 {
-	UE::Rive::Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-	if (!RiveRenderer)
-	{
-		UE_LOG(LogRiveCore, Error, TEXT("Failed to GetStateMachine for the Artboard as we do not have a valid renderer."));
-		return nullptr;
-	}
-	
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-	
 	if (!DefaultStateMachinePtr)
 	{
 		// Not all artboards have state machines, so let's not error it out
@@ -490,21 +676,30 @@ void URiveArtboard::PopulateReportedEvents()
 	
 	if (const UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine())
 	{
-		const int32 NumReportedEvents = StateMachine->GetReportedEventsCount();
-		TickRiveReportedEvents.Reserve(NumReportedEvents);
-
-		for (int32 EventIndex = 0; EventIndex < NumReportedEvents; EventIndex++)
 		{
-			const rive::EventReport ReportedEvent = StateMachine->GetReportedEvent(EventIndex);
-			if (ReportedEvent.event() != nullptr)
+			// Only hold our lock while reading the native events, the delegates below are free to call back into the Artboard
+			UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+			
+			const int32 NumReportedEvents = StateMachine->GetReportedEventsCount();
+			TickRiveReportedEvents.Reserve(NumReportedEvents);
+
+			for (int32 EventIndex = 0; EventIndex < NumReportedEvents; EventIndex++)
 			{
-				FRiveEvent RiveEvent;
-				RiveEvent.Initialize(ReportedEvent);
-				if (const FRiveNamedEventsDelegate* NamedEventDelegate = NamedRiveEventsDelegates.Find(RiveEvent.Name))
+				const rive::EventReport ReportedEvent = StateMachine->GetReportedEvent(EventIndex);
+				if (ReportedEvent.event() != nullptr)
 				{
-					NamedEventDelegate->Broadcast(this, RiveEvent);
+					FRiveEvent RiveEvent;
+					RiveEvent.Initialize(ReportedEvent);
+					TickRiveReportedEvents.Add(MoveTemp(RiveEvent));
 				}
-				TickRiveReportedEvents.Add(MoveTemp(RiveEvent));
+			}
+		}
+
+		for (const FRiveEvent& RiveEvent : TickRiveReportedEvents)
+		{
+			if (const FRiveNamedEventsDelegate* NamedEventDelegate = NamedRiveEventsDelegates.Find(RiveEvent.Name))
+			{
+				NamedEventDelegate->Broadcast(this, RiveEvent);
 			}
 		}
 
@@ -521,14 +716,151 @@ void URiveArtboard::PopulateReportedEvents()
 #endif // WITH_RIVE
 }
 
+void URiveArtboard::EnqueueInputCommand(UE::Rive::Core::FURInputCommand&& InInputCommand) const
+{
+	InInputCommand.Sequence = InputSequence.fetch_add(1, std::memory_order_relaxed);
+	PendingInputCommands.Enqueue(MoveTemp(InInputCommand));
+}
+
+void URiveArtboard::ApplyPendingInputCommands()
+{
+	UE::Rive::Core::FURStateMachine* StateMachine = GetStateMachine();
+	
+	FreeRetiredInputSlotSets();
+	
+	// Handle writes only keep the last one of each Input, they are interleaved with the queued commands by sequence
+	// so the last write of an Input wins, whether it was made by name or by handle
+	UE::Rive::Core::FURInputSlotSet* SlotSet = InputSlotSets.IsEmpty() ? nullptr : InputSlotSets.Last().Get();
+	TArray<TPair<uint32, int32>, TInlineAllocator<16>> PendingSlots;
+	if (SlotSet && StateMachine && bHasPendingInputSlots.exchange(false, std::memory_order_acquire))
+	{
+		for (int32 SlotIndex = 0; SlotIndex < SlotSet->Num; ++SlotIndex)
+		{
+			const UE::Rive::Core::FURInputSlot& InputSlot = SlotSet->Slots[SlotIndex];
+			if (InputSlot.bHasPendingValue.load(std::memory_order_acquire) || InputSlot.PendingTriggerCount.load(std::memory_order_acquire) != 0)
+			{
+				PendingSlots.Emplace(InputSlot.PendingSequence.load(std::memory_order_relaxed), SlotIndex);
+			}
+		}
+		// Compared by difference, so the order holds when the sequence wraps around
+		PendingSlots.Sort([](const TPair<uint32, int32>& A, const TPair<uint32, int32>& B)
+		{
+			return static_cast<int32>(A.Key - B.Key) < 0;
+		});
+	}
+	
+	int32 NextPendingSlot = 0;
+	auto ApplyPendingSlotsBefore = [SlotSet, &PendingSlots, &NextPendingSlot](const uint32* InSequence)
+	{
+		for (; NextPendingSlot < PendingSlots.Num(); ++NextPendingSlot)
+		{
+			if (InSequence && static_cast<int32>(PendingSlots[NextPendingSlot].Key - *InSequence) >= 0)
+			{
+				return;
+			}
+			
+			UE::Rive::Core::FURInputSlot& InputSlot = SlotSet->Slots[PendingSlots[NextPendingSlot].Value];
+			if (InputSlot.bHasPendingValue.exchange(false, std::memory_order_acquire))
+			{
+				const float PendingValue = InputSlot.PendingValue.load(std::memory_order_relaxed);
+				if (InputSlot.Type == UE::Rive::Core::FURInputCommand::EType::Bool)
+				{
+					static_cast<rive::SMIBool*>(InputSlot.NativeInput)->value(PendingValue != 0.f);
+				}
+				else if (InputSlot.Type == UE::Rive::Core::FURInputCommand::EType::Number)
+				{
+					static_cast<rive::SMINumber*>(InputSlot.NativeInput)->value(PendingValue);
+				}
+			}
+			if (InputSlot.PendingTriggerCount.exchange(0, std::memory_order_acquire) != 0)
+			{
+				static_cast<rive::SMITrigger*>(InputSlot.NativeInput)->fire();
+			}
+		}
+	};
+	
+	UE::Rive::Core::FURInputCommand InputCommand;
+	while (PendingInputCommands.Dequeue(InputCommand))
+	{
+		ApplyPendingSlotsBefore(&InputCommand.Sequence);
+		
+		if (!StateMachine || !NativeArtboardPtr)
+		{
+			continue;
+		}
+		
+		switch (InputCommand.Type)
+		{
+		case UE::Rive::Core::FURInputCommand::EType::Bool:
+			StateMachine->SetBoolValue(InputCommand.Name, InputCommand.bBoolValue);
+			break;
+		case UE::Rive::Core::FURInputCommand::EType::Number:
+			StateMachine->SetNumberValue(InputCommand.Name, InputCommand.NumberValue);
+			break;
+		case UE::Rive::Core::FURInputCommand::EType::Trigger:
+			StateMachine->FireTrigger(InputCommand.Name);
+			break;
+		case UE::Rive::Core::FURInputCommand::EType::Text:
+			if (rive::TextValueRunBase* TextValueRun = NativeArtboardPtr->find<rive::TextValueRunBase>(TCHAR_TO_UTF8(*InputCommand.Name)))
+			{
+				TextValueRun->text(TCHAR_TO_UTF8(*InputCommand.TextValue));
+			}
+			break;
+		}
+	}
+	
+	ApplyPendingSlotsBefore(nullptr);
+}
+
+UE::Rive::Core::FURInputSlot* URiveArtboard::GetInputSlot(const FRiveInputHandle& InHandle, UE::Rive::Core::FURInputCommand::EType InExpectedType) const
+{
+	// Published by Initialize_Internal once filled. The set read here stays alive if a re-initialization retires it meanwhile,
+	// as long as the caller holds the Artboard lock or a FRiveInputSlotWriteScope
+	UE::Rive::Core::FURInputSlotSet* SlotSet = InputSlotSet.load(std::memory_order_seq_cst);
+	if (!InHandle.IsValid() || !SlotSet || InHandle.Generation != SlotSet->Generation || InHandle.Index >= SlotSet->Num)
+	{
+		UE_LOG(LogRiveCore, Error, TEXT("Invalid input handle for Artboard '%s', it was not resolved against the current state machine."), *GetArtboardName());
+		return nullptr;
+	}
+	
+	UE::Rive::Core::FURInputSlot& InputSlot = SlotSet->Slots[InHandle.Index];
+	if (!InputSlot.NativeInput || InputSlot.Type != InExpectedType)
+	{
+		UE_LOG(LogRiveCore, Error, TEXT("Input handle for Artboard '%s' does not refer to an input of the expected type."), *GetArtboardName());
+		return nullptr;
+	}
+	return &InputSlot;
+}
+
+void URiveArtboard::FreeRetiredInputSlotSets()
+{
+	// Setters starting after the current set got published only load it, so the retired ones are unreachable once no Setter is in flight
+	if (InputSlotSets.Num() > 1 && NumInputSlotWriters.load(std::memory_order_seq_cst) == 0)
+	{
+		InputSlotSets.RemoveAt(0, InputSlotSets.Num() - 1);
+	}
+}
+
+rive::TextValueRunBase* URiveArtboard::GetTextRun(const FRiveTextRunHandle& InHandle) const
+{
+	if (!InHandle.IsValid() || InHandle.Generation != InitializationCount || !TextRuns.IsValidIndex(InHandle.Index))
+	{
+		UE_LOG(LogRiveCore, Error, TEXT("Invalid text run handle for Artboard '%s', it was not resolved against the current artboard."), *GetArtboardName());
+		return nullptr;
+	}
+	return TextRuns[InHandle.Index];
+}
+
 void URiveArtboard::Initialize_Internal(const rive::Artboard* InNativeArtboard)
 {
+	UE::Rive::Renderer::FRiveScopeLock Lock(ArtboardCSPtr, GET_STATID(STAT_RiveCoreArtboardLockWait));
+	
 	NativeArtboardPtr = InNativeArtboard->instance();
 	ArtboardName = FString{NativeArtboardPtr->name().c_str()};
 	NativeArtboardPtr->advance(0);
 
 	DefaultStateMachinePtr = MakeUnique<UE::Rive::Core::FURStateMachine>(
-		NativeArtboardPtr.get(), StateMachineName);
+		NativeArtboardPtr.get(), StateMachineName, ArtboardCSPtr);
 
 	// UI Helpers
 	StateMachineNames.Empty();
@@ -545,6 +877,20 @@ void URiveArtboard::Initialize_Internal(const rive::Artboard* InNativeArtboard)
 		EventNames.Add(Event->name().c_str());
 	}
 
+	TextRuns.Empty();
+	const std::vector<rive::TextValueRunBase*> NativeTextRuns = NativeArtboardPtr->find<rive::TextValueRunBase>();
+	TextRuns.Append(NativeTextRuns.data(), NativeTextRuns.size());
+
+	// Previously resolved handles now get rejected
+	++InitializationCount;
+	bIsSettled = false;
+	bNeedsRedraw = true;
+	bHasUnreportedEvents = false;
+	bHasPendingInputSlots = false;
+	const int32 NumInputSlots = DefaultStateMachinePtr->IsValid() ? DefaultStateMachinePtr->GetInputCount() : 0;
+	TUniquePtr<UE::Rive::Core::FURInputSlotSet> NewSlotSet = MakeUnique<UE::Rive::Core::FURInputSlotSet>(InitializationCount, NumInputSlots);
+	UE::Rive::Core::FURInputSlot* InputSlots = NewSlotSet->Slots.Get();
+
 	BoolInputNames.Empty();
 	NumberInputNames.Empty();
 	TriggerInputNames.Empty();
@@ -552,18 +898,24 @@ void URiveArtboard::Initialize_Internal(const rive::Artboard* InNativeArtboard)
 	{
 		for (uint32 i = 0; i < DefaultStateMachinePtr->GetInputCount(); ++i)
 		{
-			const rive::SMIInput* Input = DefaultStateMachinePtr->GetInput(i);
+			rive::SMIInput* Input = DefaultStateMachinePtr->GetInput(i);
 			if (Input->input()->is<rive::StateMachineBoolBase>())
 			{
 				BoolInputNames.Add(Input->name().c_str());
+				InputSlots[i].NativeInput = Input;
+				InputSlots[i].Type = UE::Rive::Core::FURInputCommand::EType::Bool;
 			}
 			else if (Input->input()->is<rive::StateMachineNumberBase>())
 			{
 				NumberInputNames.Add(Input->name().c_str());
+				InputSlots[i].NativeInput = Input;
+				InputSlots[i].Type = UE::Rive::Core::FURInputCommand::EType::Number;
 			}
 			else if (Input->input()->is<rive::StateMachineTriggerBase>())
 			{
 				TriggerInputNames.Add(Input->name().c_str());
+				InputSlots[i].NativeInput = Input;
+				InputSlots[i].Type = UE::Rive::Core::FURInputCommand::EType::Trigger;
 			}
 			else
 			{
@@ -572,6 +924,11 @@ void URiveArtboard::Initialize_Internal(const rive::Artboard* InNativeArtboard)
 			}
 		}
 	}
+
+	// The previous set is retired, it is freed once no handle Setter may still be writing into it
+	InputSlotSet.store(NewSlotSet.Get(), std::memory_order_seq_cst);
+	InputSlotSets.Add(MoveTemp(NewSlotSet));
+	FreeRetiredInputSlotSets();
 	
 	bIsInitialized = true;
 }
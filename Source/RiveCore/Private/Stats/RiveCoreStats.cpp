@@ -0,0 +1,6 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveCoreStats.h"
+
+DEFINE_STAT(STAT_RiveCoreArtboardLockWait);
+DEFINE_STAT(STAT_RiveCoreSkippedAdvances);
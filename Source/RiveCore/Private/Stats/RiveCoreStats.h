@@ -0,0 +1,13 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "Stats/Stats2.h"
+
+DECLARE_STATS_GROUP(TEXT("RiveCore"), STATGROUP_RiveCore, STATCAT_Advanced);
+
+/** Time spent by the Game Thread waiting on an Artboard lock (inputs, advance, events) */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Artboard Lock Wait (GT)"), STAT_RiveCoreArtboardLockWait, STATGROUP_RiveCore, );
+
+/** Artboards whose State Machine settled and was not advanced this frame */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Advances"), STAT_RiveCoreSkippedAdvances, STATGROUP_RiveCore, );
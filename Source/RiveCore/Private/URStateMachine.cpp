@@ -2,9 +2,9 @@
 
 #include "URStateMachine.h"
 
-#include "IRiveRenderer.h"
-#include "IRiveRendererModule.h"
+#include "RiveScopeLock.h"
 #include "Logs/RiveCoreLog.h"
+#include "Stats/RiveCoreStats.h"
 
 #if WITH_RIVE
 #include "PreRiveHeaders.h"
@@ -17,13 +17,10 @@ THIRD_PARTY_INCLUDES_END
 
 rive::EventReport UE::Rive::Core::FURStateMachine::NullEvent = rive::EventReport(nullptr, 0.f);
 
-UE::Rive::Core::FURStateMachine::FURStateMachine(rive::ArtboardInstance* InNativeArtboardInst, const FString& InStateMachineName)
+UE::Rive::Core::FURStateMachine::FURStateMachine(rive::ArtboardInstance* InNativeArtboardInst, const FString& InStateMachineName, FCriticalSection* InArtboardCS)
+    : ArtboardCS(InArtboardCS)
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        RiveRenderer->GetThreadDataCS().Lock();
-    }
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (InStateMachineName.IsEmpty())
     {
@@ -44,26 +41,15 @@ UE::Rive::Core::FURStateMachine::FURStateMachine(rive::ArtboardInstance* InNativ
     {
         StateMachineName = NativeStateMachinePtr->name().c_str();
     }
-
-    if (RiveRenderer)
-    {
-        RiveRenderer->GetThreadDataCS().Unlock();
-    }
 }
 
 bool UE::Rive::Core::FURStateMachine::Advance(float InSeconds)
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to Advance the StateMachine as we do not have a valid renderer."));
-        return false;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (NativeStateMachinePtr)
     {
+        bHasPendingInteraction.store(false, std::memory_order_release);
         return NativeStateMachinePtr->advanceAndApply(InSeconds);
     }
     
@@ -72,14 +58,7 @@ bool UE::Rive::Core::FURStateMachine::Advance(float InSeconds)
 
 uint32 UE::Rive::Core::FURStateMachine::GetInputCount() const
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to GetInputCount on the StateMachine as we do not have a valid renderer."));
-        return 0;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (NativeStateMachinePtr)
     {
@@ -91,14 +70,7 @@ uint32 UE::Rive::Core::FURStateMachine::GetInputCount() const
 
 rive::SMIInput* UE::Rive::Core::FURStateMachine::GetInput(uint32 AtIndex) const
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to GetInput on the StateMachine as we do not have a valid renderer."));
-        return nullptr;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (NativeStateMachinePtr)
     {
@@ -110,8 +82,7 @@ rive::SMIInput* UE::Rive::Core::FURStateMachine::GetInput(uint32 AtIndex) const
 
 void UE::Rive::Core::FURStateMachine::FireTrigger(const FString& InPropertyName) const
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr)
     {
@@ -121,6 +92,7 @@ void UE::Rive::Core::FURStateMachine::FireTrigger(const FString& InPropertyName)
     if (rive::SMITrigger* TriggerToBeFired = NativeStateMachinePtr->getTrigger(TCHAR_TO_UTF8(*InPropertyName)))
     {
         TriggerToBeFired->fire();
+        bHasPendingInteraction.store(true, std::memory_order_release);
         return;
     }
 
@@ -129,14 +101,7 @@ void UE::Rive::Core::FURStateMachine::FireTrigger(const FString& InPropertyName)
 
 bool UE::Rive::Core::FURStateMachine::GetBoolValue(const FString& InPropertyName) const
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to GetBoolValue on the StateMachine as we do not have a valid renderer."));
-        return false;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr)
     {
@@ -154,14 +119,7 @@ bool UE::Rive::Core::FURStateMachine::GetBoolValue(const FString& InPropertyName
 
 float UE::Rive::Core::FURStateMachine::GetNumberValue(const FString& InPropertyName) const
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to GetNumberValue on the StateMachine as we do not have a valid renderer."));
-        return 0.f;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr)
     {
@@ -179,14 +137,7 @@ float UE::Rive::Core::FURStateMachine::GetNumberValue(const FString& InPropertyN
 
 void UE::Rive::Core::FURStateMachine::SetBoolValue(const FString& InPropertyName, bool bNewValue)
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to SetBoolValue on the StateMachine as we do not have a valid renderer."));
-        return;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr)
     {
@@ -196,6 +147,7 @@ void UE::Rive::Core::FURStateMachine::SetBoolValue(const FString& InPropertyName
     if (rive::SMIBool* BoolProperty = NativeStateMachinePtr->getBool(TCHAR_TO_UTF8(*InPropertyName)))
     {
         BoolProperty->value(bNewValue);
+        bHasPendingInteraction.store(true, std::memory_order_release);
         return;
     }
     
@@ -204,14 +156,7 @@ void UE::Rive::Core::FURStateMachine::SetBoolValue(const FString& InPropertyName
 
 void UE::Rive::Core::FURStateMachine::SetNumberValue(const FString& InPropertyName, float NewValue)
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to SetNumberValue on the StateMachine as we do not have a valid renderer."));
-        return;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr)
     {
@@ -221,6 +166,7 @@ void UE::Rive::Core::FURStateMachine::SetNumberValue(const FString& InPropertyNa
     if (rive::SMINumber* NumberProperty = NativeStateMachinePtr->getNumber(TCHAR_TO_UTF8(*InPropertyName)))
     {
         NumberProperty->value(NewValue);
+        bHasPendingInteraction.store(true, std::memory_order_release);
         return;
     }
  
@@ -229,14 +175,7 @@ void UE::Rive::Core::FURStateMachine::SetNumberValue(const FString& InPropertyNa
 
 bool UE::Rive::Core::FURStateMachine::OnMouseButtonDown(const FVector2f& NewPosition)
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to call OnMouseButtonDown on the StateMachine as we do not have a valid renderer."));
-        return false;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
 
     if (!NativeStateMachinePtr)
     {
@@ -244,19 +183,13 @@ bool UE::Rive::Core::FURStateMachine::OnMouseButtonDown(const FVector2f& NewPosi
     }
     
     NativeStateMachinePtr->pointerDown({ NewPosition.X, NewPosition.Y });
+    bHasPendingInteraction.store(true, std::memory_order_release);
     return true;
 }
 
 bool UE::Rive::Core::FURStateMachine::OnMouseMove(const FVector2f& NewPosition)
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to call OnMouseMove on the StateMachine as we do not have a valid renderer."));
-        return false;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr)
     {
@@ -264,19 +197,13 @@ bool UE::Rive::Core::FURStateMachine::OnMouseMove(const FVector2f& NewPosition)
     }
     
     NativeStateMachinePtr->pointerMove({ NewPosition.X, NewPosition.Y });
+    bHasPendingInteraction.store(true, std::memory_order_release);
     return true;
 }
 
 bool UE::Rive::Core::FURStateMachine::OnMouseButtonUp(const FVector2f& NewPosition)
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to call OnMouseButtonUp on the StateMachine as we do not have a valid renderer."));
-        return false;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr)
     {
@@ -284,19 +211,13 @@ bool UE::Rive::Core::FURStateMachine::OnMouseButtonUp(const FVector2f& NewPositi
     }
    
     NativeStateMachinePtr->pointerUp({ NewPosition.X, NewPosition.Y });
+    bHasPendingInteraction.store(true, std::memory_order_release);
     return true;
 }
 
 const rive::EventReport UE::Rive::Core::FURStateMachine::GetReportedEvent(int32 AtIndex) const
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to GetReportedEvent on the StateMachine as we do not have a valid renderer."));
-        return NullEvent;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr || !HasAnyReportedEvents())
     {
@@ -308,14 +229,7 @@ const rive::EventReport UE::Rive::Core::FURStateMachine::GetReportedEvent(int32
 
 int32 UE::Rive::Core::FURStateMachine::GetReportedEventsCount() const
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to GetReportedEventsCount on the StateMachine as we do not have a valid renderer."));
-        return 0;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr || !HasAnyReportedEvents())
     {
@@ -327,14 +241,7 @@ int32 UE::Rive::Core::FURStateMachine::GetReportedEventsCount() const
 
 bool UE::Rive::Core::FURStateMachine::HasAnyReportedEvents() const
 {
-    Renderer::IRiveRenderer* RiveRenderer = UE::Rive::Renderer::IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRiveCore, Error, TEXT("Failed to HasAnyReportedEvents on the StateMachine as we do not have a valid renderer."));
-        return false;
-    }
-    
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    Renderer::FRiveScopeLock Lock(ArtboardCS, GET_STATID(STAT_RiveCoreArtboardLockWait));
     
     if (!NativeStateMachinePtr)
     {
@@ -23,9 +23,15 @@ THIRD_PARTY_INCLUDES_END
 
 namespace UE::Rive::Assets
 {
+    class FURAssetImporter;
+
     /**
      * Unreal extension of rive::FileAssetLoader implementation (partial) for the Unreal RHI.
      * This loads assets (either embedded or OOB by using their loaded bytes)
+     * Given an FURAssetImporter, the OOB assets are imported first, so a new Rive File is imported and loaded in a single rive::File::import
+     * Images and fonts are only gathered during the import, DecodeGatheredAssets then decodes them all concurrently
+     * Once CopyAssetBytes was called on the Game Thread, the import and the decoding read no UObject and can run on any thread,
+     * PublishDecodedAssets then hands the decoded assets to their URiveAsset back on the Game Thread
      */
     class RIVECORE_API FURFileAssetLoader
 #if WITH_RIVE
@@ -38,7 +44,7 @@ namespace UE::Rive::Assets
 
     public:
 
-        FURFileAssetLoader(UObject* InOuter, TMap<uint32, TObjectPtr<URiveAsset>>& InAssets);
+        FURFileAssetLoader(UObject* InOuter, TMap<uint32, TObjectPtr<URiveAsset>>& InAssets, FURAssetImporter* InAssetImporter = nullptr);
 
 #if WITH_RIVE
 
@@ -49,6 +55,21 @@ namespace UE::Rive::Assets
 
         //~ END : rive::FileAssetLoader Interface
 
+        /**
+         * Implementation(s)
+         */
+
+    public:
+
+        /** Copies the bytes of the URiveAssets, so the import no longer reads them. To be called on the Game Thread, not supported with an FURAssetImporter */
+        void CopyAssetBytes();
+
+        /** Decodes the images and fonts gathered by loadContents on worker threads, to be called once rive::File::import succeeded */
+        void DecodeGatheredAssets();
+
+        /** Sets the native asset of the URiveAssets decoded by DecodeGatheredAssets, to be called on the Game Thread */
+        void PublishDecodedAssets();
+
 #endif // WITH_RIVE
 
     public:
@@ -60,5 +81,34 @@ namespace UE::Rive::Assets
     private:
         TObjectPtr<UObject> Outer;
         TMap<uint32, TObjectPtr<URiveAsset>>& Assets;
+        FURAssetImporter* AssetImporter;
+
+#if WITH_RIVE
+        struct FGatheredAsset
+        {
+            rive::FileAsset* NativeAsset = nullptr;
+
+            rive::Factory* Factory = nullptr;
+
+            /** False for the in-band assets which were not imported */
+            bool bHasRiveAsset = false;
+
+            /** Bytes of the URiveAsset, or of its copy, when the in-band bytes are empty */
+            const TArray<uint8>* AssetBytes = nullptr;
+
+            /** Copy of the in-band bytes, they are owned by the importer and not guaranteed to outlive loadContents */
+            TArray<uint8> InBandBytes;
+
+            bool bIsDecoded = false;
+        };
+
+        TArray<FGatheredAsset> GatheredAssets;
+
+        /** Decoded assets having a URiveAsset, by id, until PublishDecodedAssets */
+        TArray<TPair<uint32, rive::FileAsset*>> DecodedAssets;
+
+        /** Filled by CopyAssetBytes, read instead of the URiveAssets */
+        TOptional<TMap<uint32, TArray<uint8>>> CopiedAssetBytes;
+#endif // WITH_RIVE
     };
 }
@@ -1,9 +1,12 @@
 // Copyright Rive, Inc. All rights reserved.
 #pragma once
+#include "Containers/Queue.h"
 #include "IRiveRenderTarget.h"
 #include "MatrixTypes.h"
 #include "RiveEvent.h"
+#include "RiveInputHandle.h"
 #include "RiveTypes.h"
+#include "URInputCommand.h"
 #include "URStateMachine.h"
 
 #if WITH_RIVE
@@ -13,6 +16,11 @@ class URiveFile;
 THIRD_PARTY_INCLUDES_START
 #include "rive/file.hpp"
 THIRD_PARTY_INCLUDES_END
+
+namespace rive
+{
+	class TextValueRunBase;
+}
 #endif // WITH_RIVE
 
 #include "RiveArtboard.generated.h"
@@ -71,7 +79,31 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = Rive)
 	void Draw();
+
+	/** Saves the transform and clip of the render target, until the matching Restore */
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	void Save();
+
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	void Restore();
+
+	/**
+	 * Draws a path built by game code with the current transform, in the same PLS frame as the Artboards of the render target.
+	 * The path and paint are created with the factory of IRiveRenderer::GetFactory, see IRiveRenderTarget::DrawPath.
+	 */
+	void DrawPath(rive::RenderPath* InPath, rive::RenderPaint* InPaint);
+
+	/** Clips the next draws to the path, until the enclosing Save is restored */
+	void ClipPath(rive::RenderPath* InPath);
+
+	/** Forces the State Machine to be advanced and the Artboard to be redrawn on the next tick, even if it settled */
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	void RequestRedraw();
 	
+	/**
+	 * The Setters below can be called from any thread. They are queued without blocking and applied in order right before the next advance of the State Machine,
+	 * so the Getters only reflect them after that advance.
+	 */
 	UFUNCTION(BlueprintCallable, Category = Rive)
 	void FireTrigger(const FString& InPropertyName) const;
 	UFUNCTION(BlueprintCallable, Category = Rive)
@@ -88,6 +120,33 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Rive)
 	void SetTextValue(const FString& InPropertyName, const FString& NewValue);
 	
+	/** Resolves the Input of the State Machine once, the returned handle is then used without any name lookup nor allocation */
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	FRiveInputHandle ResolveInput(const FString& InInputName) const;
+	/** Resolves the Text Run once, the returned handle is then used without any component traversal */
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	FRiveTextRunHandle ResolveTextRun(const FString& InTextRunName) const;
+
+	/**
+	 * Handle based Setters can be called from any thread, the last value written is applied right before the next advance of the State Machine.
+	 * Writes to the same Input by name and by handle are applied in the order they were made, the last one wins.
+	 */
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	void FireTriggerByHandle(const FRiveInputHandle& InHandle) const;
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	void SetBoolValueByHandle(const FRiveInputHandle& InHandle, bool bNewValue);
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	void SetNumberValueByHandle(const FRiveInputHandle& InHandle, float NewValue);
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	void SetTextValueByHandle(const FRiveTextRunHandle& InHandle, const FString& NewValue);
+
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	bool GetBoolValueByHandle(const FRiveInputHandle& InHandle) const;
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	float GetNumberValueByHandle(const FRiveInputHandle& InHandle) const;
+	UFUNCTION(BlueprintCallable, Category = Rive)
+	FString GetTextValueByHandle(const FRiveTextRunHandle& InHandle) const;
+	
 	UFUNCTION(BlueprintCallable, Category = Rive)
 	bool BindNamedRiveEvent(const FString& EventName, const FRiveNamedEventDelegate& Event);
 	UFUNCTION(BlueprintCallable, Category = Rive)
@@ -118,6 +177,32 @@ public:
 	bool IsInitialized() const { return bIsInitialized; }
 
 	void Tick(float InDeltaSeconds);
+
+	/** Records the draw of this Artboard, either through OnArtboardTick_Render or by calling Draw */
+	void Tick_Render(float InDeltaSeconds);
+	/** Advances the State Machine, either through OnArtboardTick_StateMachine or by calling AdvanceStateMachine */
+	void Tick_StateMachine(float InDeltaSeconds);
+
+	/** Returns true if the State Machine tick can be split between the Game Thread and any thread, i.e. it is not overridden by OnArtboardTick_StateMachine */
+	bool CanAdvanceStateMachineOffGameThread() const { return bIsInitialized && RiveRenderTarget && !OnArtboardTick_StateMachine.IsBound(); }
+
+	/**
+	 * Game Thread part of AdvanceStateMachine, broadcasting the events reported by the previous advance.
+	 * Returns true if AdvanceStateMachine_AnyThread should be called this frame.
+	 */
+	bool PreAdvanceStateMachine_GameThread();
+
+	/** Part of AdvanceStateMachine which can run on any thread: applies the pending inputs and advances the native State Machine */
+	void AdvanceStateMachine_AnyThread(float InDeltaSeconds);
+
+	/**
+	 * Returns true if the Artboard changed since its last Draw, or if its draw is overridden by OnArtboardTick_Render.
+	 * When false, the previous content of the Render Target is still up to date.
+	 */
+	bool NeedsRedraw() const;
+
+	/** Returns true if the State Machine is still running, or if anything was sent to it since it settled */
+	bool HasPendingStateMachineChanges() const;
 	/**
 	 * Implementation(s)
 	 */
@@ -130,6 +215,9 @@ public:
 
 	UE::Rive::Core::FURStateMachine* GetStateMachine() const;
 
+	/** Returns the lock guarding the native Artboard and State Machine instances, to hold while accessing them directly */
+	FCriticalSection* GetArtboardCS() const { return ArtboardCSPtr; }
+
 	void BeginInput()
 	{
 		bIsReceivingInput = true;
@@ -145,16 +233,48 @@ public:
 
 private:
 	void PopulateReportedEvents();
+	/** Stamps the command with the next input sequence and queues it */
+	void EnqueueInputCommand(UE::Rive::Core::FURInputCommand&& InInputCommand) const;
+	/** Applies the queued input commands and the pending handle values, in the order they were written. Expects the Artboard lock to be held */
+	void ApplyPendingInputCommands();
+	UE::Rive::Core::FURInputSlot* GetInputSlot(const FRiveInputHandle& InHandle, UE::Rive::Core::FURInputCommand::EType InExpectedType) const;
+	/** Frees the retired slot sets when no handle Setter is writing, expects the Artboard lock to be held */
+	void FreeRetiredInputSlotSets();
+	rive::TextValueRunBase* GetTextRun(const FRiveTextRunHandle& InHandle) const;
 	
 	void Initialize_Internal(const rive::Artboard* InNativeArtboard);
-	void Tick_Render(float InDeltaSeconds);
-	void Tick_StateMachine(float InDeltaSeconds);
 	
 	UE::Rive::Renderer::IRiveRenderTargetPtr RiveRenderTarget;
 	mutable bool bIsInitialized = false;
 
 	std::unique_ptr<rive::ArtboardInstance> NativeArtboardPtr = nullptr;
 	UE::Rive::Core::FURStateMachinePtr DefaultStateMachinePtr = nullptr;
+
+	/** Guards the native instances between the threads setting inputs, advancing and recording the draw snapshot. The Render Thread never takes it */
+	mutable FCriticalSection ArtboardCS;
+	/** Lock in use, ArtboardCS unless Rive.Artboard.UseRendererLock was set when this Artboard got initialized */
+	FCriticalSection* ArtboardCSPtr = &ArtboardCS;
+	/** Input mutations queued from any thread, drained before each advance */
+	mutable TQueue<UE::Rive::Core::FURInputCommand, EQueueMode::Mpsc> PendingInputCommands;
+	/** Slots of the current initialization, one per Input of the State Machine, indexed by FRiveInputHandle. Read by the handle Setters without any lock */
+	std::atomic<UE::Rive::Core::FURInputSlotSet*> InputSlotSet { nullptr };
+	/** Owns the current slot set, last, and the retired ones not freed yet, only modified under the Artboard lock */
+	TArray<TUniquePtr<UE::Rive::Core::FURInputSlotSet>> InputSlotSets;
+	/** Handle Setters currently writing into a slot set, the retired sets are only freed while it is zero */
+	mutable std::atomic<uint32> NumInputSlotWriters { 0 };
+	mutable std::atomic<bool> bHasPendingInputSlots { false };
+	/** Source of FURInputCommand::Sequence */
+	mutable std::atomic<uint32> InputSequence { 0 };
+	/** Text Runs of the Artboard, indexed by FRiveTextRunHandle */
+	TArray<rive::TextValueRunBase*> TextRuns;
+	/** Incremented on each initialization to reject handles resolved against the previous native instances */
+	uint32 InitializationCount = 0;
+	/** Set when the last advance reported that the State Machine settled, cleared by anything which may wake it up */
+	std::atomic<bool> bIsSettled { false };
+	/** Set by each advance, cleared by Draw */
+	std::atomic<bool> bNeedsRedraw { true };
+	/** Set when the last advance reported events, cleared once they got broadcast so they are not broadcast again while settled */
+	std::atomic<bool> bHasUnreportedEvents { false };
 #endif // WITH_RIVE
 public:
 	const FString& GetArtboardName() const { return ArtboardName; }
@@ -91,6 +91,7 @@ struct RIVECORE_API FRiveEvent
 
 #if WITH_RIVE
 
+    /** Reads the reported event, the caller is expected to hold the lock of the Artboard which reported it */
     void Initialize(const rive::EventReport& InEventReport);
 
 #endif // WITH_RIVE
@@ -0,0 +1,44 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+
+#include "RiveInputHandle.generated.h"
+
+/**
+ * Handle to a State Machine Input of an Artboard, resolved once by name with URiveArtboard::ResolveInput.
+ * Setting or getting a value through it does not need any name lookup.
+ */
+USTRUCT(BlueprintType)
+struct RIVECORE_API FRiveInputHandle
+{
+	GENERATED_BODY()
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	/** Index of the Input in the State Machine of the Artboard which resolved this handle */
+	int32 Index = INDEX_NONE;
+
+	/** Initialization count of the Artboard at resolve time, handles resolved before a re-initialization are rejected */
+	uint32 Generation = 0;
+};
+
+/**
+ * Handle to a Text Run of an Artboard, resolved once by name with URiveArtboard::ResolveTextRun.
+ * Setting or getting the text through it does not need any component traversal.
+ */
+USTRUCT(BlueprintType)
+struct RIVECORE_API FRiveTextRunHandle
+{
+	GENERATED_BODY()
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	/** Index of the Text Run in the Artboard which resolved this handle */
+	int32 Index = INDEX_NONE;
+
+	/** Initialization count of the Artboard at resolve time, handles resolved before a re-initialization are rejected */
+	uint32 Generation = 0;
+};
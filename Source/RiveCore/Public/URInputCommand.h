@@ -0,0 +1,109 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+namespace rive
+{
+    class SMIInput;
+}
+
+namespace UE::Rive::Core
+{
+    /**
+     * Pending mutation of a State Machine Input or of a Text Run. Can be queued from any thread and gets applied by the owning Artboard right before its next advance.
+     */
+    struct FURInputCommand
+    {
+        enum class EType : uint8
+        {
+            Bool,
+            Number,
+            Trigger,
+            Text
+        };
+
+        /**
+         * Structor(s)
+         */
+
+        FURInputCommand() = default;
+
+        FURInputCommand(EType InType, const FString& InName)
+            : Type(InType)
+            , Name(InName)
+        {
+        }
+
+        /**
+         * Attribute(s)
+         */
+
+        EType Type = EType::Trigger;
+
+        /** Name of the Input or of the Text Run */
+        FString Name;
+
+        /** Order of this write among all the input writes of the Artboard, by name or by handle */
+        uint32 Sequence = 0;
+
+        bool bBoolValue = false;
+
+        float NumberValue = 0.f;
+
+        FString TextValue;
+    };
+
+    /**
+     * Resolved State Machine Input targeted by FRiveInputHandle. The pending value is written without allocation nor lock from any thread,
+     * the last write wins and gets applied by the owning Artboard right before its next advance.
+     */
+    struct FURInputSlot
+    {
+        /** Native Input, only accessed under the owning Artboard lock */
+        rive::SMIInput* NativeInput = nullptr;
+
+        FURInputCommand::EType Type = FURInputCommand::EType::Trigger;
+
+        /** Pending value, bool Inputs store 0 or 1 */
+        std::atomic<float> PendingValue { 0.f };
+
+        std::atomic<bool> bHasPendingValue { false };
+
+        std::atomic<uint32> PendingTriggerCount { 0 };
+
+        /** Sequence of the last write, see FURInputCommand::Sequence */
+        std::atomic<uint32> PendingSequence { 0 };
+    };
+
+    /**
+     * Input slots of one initialization of an Artboard. A re-initialization publishes a new set and retires the previous one, which is only freed
+     * once no handle Setter is writing, so a Setter racing with it writes into slots which never get applied instead of into freed memory.
+     */
+    struct FURInputSlotSet
+    {
+        /**
+         * Structor(s)
+         */
+
+        FURInputSlotSet(uint32 InGeneration, int32 InNum)
+            : Generation(InGeneration)
+            , Num(InNum)
+            , Slots(MakeUnique<FURInputSlot[]>(InNum))
+        {
+        }
+
+        /**
+         * Attribute(s)
+         */
+
+        /** Initialization count of the Artboard these slots were created for, see FRiveInputHandle::Generation */
+        const uint32 Generation;
+
+        const int32 Num;
+
+        TUniquePtr<FURInputSlot[]> Slots;
+    };
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <atomic>
 
 #if WITH_RIVE
 #include "PreRiveHeaders.h"
@@ -44,7 +45,10 @@ namespace UE::Rive::Core
     	}
 #if WITH_RIVE
 
-        explicit FURStateMachine(rive::ArtboardInstance* InNativeArtboardInst, const FString& InStateMachineName);
+        /**
+         * @param InArtboardCS Lock of the owning Artboard, guarding the state machine instance together with the artboard instance it applies to
+         */
+        explicit FURStateMachine(rive::ArtboardInstance* InNativeArtboardInst, const FString& InStateMachineName, FCriticalSection* InArtboardCS);
 
         /**
          * Implementation(s)
@@ -52,8 +56,12 @@ namespace UE::Rive::Core
 
     public:
 
+        /** Returns false once the State Machine settled, i.e. advancing it again would not change anything until it gets interacted with */
         bool Advance(float InSeconds);
 
+        /** Returns true if an Input was set or a pointer event was sent since the last Advance */
+        bool HasPendingInteraction() const { return bHasPendingInteraction.load(std::memory_order_acquire); }
+
         uint32 GetInputCount() const;
 
         rive::SMIInput* GetInput(uint32 AtIndex) const;
@@ -86,6 +94,10 @@ namespace UE::Rive::Core
     	const FString& GetStateMachineName() const { return StateMachineName; }
     private:
     	FString StateMachineName;
+
+        FCriticalSection* ArtboardCS = nullptr;
+
+        mutable std::atomic<bool> bHasPendingInteraction { false };
     	
         std::unique_ptr<rive::StateMachineInstance> NativeStateMachinePtr = nullptr;
 
@@ -69,16 +69,26 @@ void UE::Rive::Renderer::Private::FRiveRenderTargetD3D11::CacheTextureTarget_Ren
 	}
 }
 
-void UE::Rive::Renderer::Private::FRiveRenderTargetD3D11::Render_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FRiveRenderCommand>& RiveRenderCommands)
+void UE::Rive::Renderer::Private::FRiveRenderTargetD3D11::Render_RenderThread(FRHICommandListImmediate& RHICmdList, FRiveRenderCommandBuffer&& InCommandBuffer)
 {
-	// First, we transition the texture to a RenderTextureView
 	FTextureRHIRef TargetTexture = RenderTarget->GetResource()->TextureRHI;
+	if (RiveRendererD3D11->IsInRenderBatch_RenderThread())
+	{
+		// The renderer transitions and renders all the targets of the batch at once
+		RiveRendererD3D11->AddBatchedTarget_RenderThread(TargetTexture, [this, CommandBuffer = MoveTemp(InCommandBuffer)]()
+		{
+			FRiveRenderTarget::Render_Internal(*CommandBuffer);
+		});
+		return;
+	}
+
+	// First, we transition the texture to a RenderTextureView
 	RHICmdList.Transition(FRHITransitionInfo(TargetTexture, ERHIAccess::Unknown, ERHIAccess::RTV));
 	// Then we render Rive, ensuring the DX11 states are reset before and after the call
-	RHICmdList.EnqueueLambda([this, RiveRenderCommands](FRHICommandListImmediate& RHICmdList)
+	RHICmdList.EnqueueLambda([this, CommandBuffer = MoveTemp(InCommandBuffer)](FRHICommandListImmediate& RHICmdList)
 	{
 		RiveRendererD3D11->ResetDXState();
-		FRiveRenderTarget::Render_Internal(RiveRenderCommands);
+		FRiveRenderTarget::Render_Internal(*CommandBuffer);
 		RiveRendererD3D11->ResetDXState();
 	});
 	// Finally we transition the texture to a UAV Graphics
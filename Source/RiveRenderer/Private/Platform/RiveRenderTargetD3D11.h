@@ -42,7 +42,7 @@ namespace UE::Rive::Renderer::Private
 		//~ BEGIN : FRiveRenderTarget Interface
 	protected:
 		// It Might need to be on rendering thread, render QUEUE is required
-		virtual void Render_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FRiveRenderCommand>& RiveRenderCommands) override;
+		virtual void Render_RenderThread(FRHICommandListImmediate& RHICmdList, FRiveRenderCommandBuffer&& InCommandBuffer) override;
 		virtual rive::rcp<rive::pls::PLSRenderTarget> GetRenderTarget() const override;
 		//~ END : FRiveRenderTarget Interface
 
@@ -7,7 +7,7 @@
 #include "DynamicRHI.h"
 #include "Engine/Texture2DDynamic.h"
 #include "Logs/RiveRendererLog.h"
-#include "RiveRenderer.h"
+#include "RiveRendererMetal.h"
 #include <Metal/Metal.h>
 
 #if WITH_RIVE
@@ -20,8 +20,11 @@ THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 #include "Mac/AutoreleasePool.h"
 
-UE::Rive::Renderer::Private::FRiveRenderTargetMetal::FRiveRenderTargetMetal(const TSharedRef<FRiveRenderer>& InRiveRenderer, const FName& InRiveName, UTexture2DDynamic* InRenderTarget)
-    : FRiveRenderTarget(InRiveRenderer, InRiveName, InRenderTarget)
+UE::Rive::Renderer::Private::FRiveRenderTargetMetal::FRiveRenderTargetMetal(const TSharedRef<FRiveRendererMetal>& InRiveRendererMetal, const FName& InRiveName, UTexture2DDynamic* InRenderTarget)
+    : FRiveRenderTarget(InRiveRendererMetal, InRiveName, InRenderTarget)
+#if WITH_RIVE
+    , RiveRendererMetal(InRiveRendererMetal)
+#endif // WITH_RIVE
 {
 }
 
@@ -107,7 +110,19 @@ void UE::Rive::Renderer::Private::FRiveRenderTargetMetal::EndFrame() const
         return;
     }
 
-    // End drawing a frame.
+    if (RiveRendererMetal->IsInRenderBatch_RenderThread())
+    {
+        // Encoded after the previous targets of the batch, the renderer commits the command buffer once all of them are flushed
+        rive::pls::PLSRenderContext::FlushResources FlushResources
+        {
+            GetRenderTarget().get(),
+            (__bridge void*)RiveRendererMetal->GetBatchCommandBuffer_RenderThread()
+        };
+        PLSRenderContextPtr->flush(FlushResources);
+        return;
+    }
+    
+    // End drawing a frame, within the autorelease pool opened by Render_Internal for the whole frame
     id<MTLCommandQueue> MetalCommandQueue = (id<MTLCommandQueue>)GDynamicRHI->RHIGetNativeGraphicsQueue();
     id<MTLCommandBuffer> flushCommandBuffer = [MetalCommandQueue commandBuffer];
     rive::pls::PLSRenderContext::FlushResources FlushResources
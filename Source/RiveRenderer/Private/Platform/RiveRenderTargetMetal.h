@@ -23,6 +23,8 @@ namespace rive::pls
 
 namespace UE::Rive::Renderer::Private
 {
+    class FRiveRendererMetal;
+
     /**
      *
      */
@@ -34,7 +36,7 @@ namespace UE::Rive::Renderer::Private
         
     public:
         
-        FRiveRenderTargetMetal(const TSharedRef<FRiveRenderer>& InRiveRenderer, const FName& InRiveName, UTexture2DDynamic* InRenderTarget);
+        FRiveRenderTargetMetal(const TSharedRef<FRiveRendererMetal>& InRiveRendererMetal, const FName& InRiveName, UTexture2DDynamic* InRenderTarget);
         virtual ~FRiveRenderTargetMetal() override;
         //~ BEGIN : IRiveRenderTarget Interface
         
@@ -58,6 +60,8 @@ namespace UE::Rive::Renderer::Private
         
     private:
         
+        TSharedRef<FRiveRendererMetal> RiveRendererMetal;
+        
         rive::rcp<rive::pls::PLSRenderTargetMetal> CachedPLSRenderTargetMetal;
         
 #endif // WITH_RIVE
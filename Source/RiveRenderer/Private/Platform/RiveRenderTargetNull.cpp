@@ -0,0 +1,58 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRenderTargetNull.h"
+
+#include "Engine/Texture2DDynamic.h"
+#include "RiveRenderer.h"
+
+#if WITH_RIVE
+#include "RiveCore/Public/PreRiveHeaders.h"
+THIRD_PARTY_INCLUDES_START
+#include "rive/pls/pls_render_target.hpp"
+THIRD_PARTY_INCLUDES_END
+#endif // WITH_RIVE
+
+UE::Rive::Renderer::Private::FRiveRenderTargetNull::FRiveRenderTargetNull(const TSharedRef<FRiveRenderer>& InRiveRenderer, const FName& InRiveName, UTexture2DDynamic* InRenderTarget)
+	: FRiveRenderTarget(InRiveRenderer, InRiveName, InRenderTarget)
+{
+}
+
+UE::Rive::Renderer::Private::FRiveRenderTargetNull::FRiveRenderTargetNull(const TSharedRef<FRiveRenderer>& InRiveRenderer, const FName& InRiveName, const FIntPoint& InSize)
+	: FRiveRenderTarget(InRiveRenderer, InRiveName, nullptr)
+	, Size(InSize)
+{
+}
+
+uint32 UE::Rive::Renderer::Private::FRiveRenderTargetNull::GetWidth() const
+{
+	return RenderTarget ? RenderTarget->SizeX : Size.X;
+}
+
+uint32 UE::Rive::Renderer::Private::FRiveRenderTargetNull::GetHeight() const
+{
+	return RenderTarget ? RenderTarget->SizeY : Size.Y;
+}
+
+#if WITH_RIVE
+
+void UE::Rive::Renderer::Private::FRiveRenderTargetNull::Submit()
+{
+	check(IsInGameThread());
+
+	MarkSubmitted();
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderTargetNull::SubmitAndClear()
+{
+	check(IsInGameThread());
+
+	MarkSubmitted();
+	ClearRenderCommands();
+}
+
+rive::rcp<rive::pls::PLSRenderTarget> UE::Rive::Renderer::Private::FRiveRenderTargetNull::GetRenderTarget() const
+{
+	return nullptr;
+}
+
+#endif // WITH_RIVE
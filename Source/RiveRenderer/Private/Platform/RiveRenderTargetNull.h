@@ -0,0 +1,74 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "RiveRenderTarget.h"
+
+namespace UE::Rive::Renderer::Private
+{
+	/**
+	 * Render Target of FRiveRendererNull. The transforms are still tracked so the input coordinates can be mapped to the Artboards,
+	 * the draws are dropped and the submissions never reach the Render Thread.
+	 */
+	class FRiveRenderTargetNull final : public FRiveRenderTarget
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		FRiveRenderTargetNull(const TSharedRef<FRiveRenderer>& InRiveRenderer, const FName& InRiveName, UTexture2DDynamic* InRenderTarget);
+
+		FRiveRenderTargetNull(const TSharedRef<FRiveRenderer>& InRiveRenderer, const FName& InRiveName, const FIntPoint& InSize);
+
+		//~ BEGIN : IRiveRenderTarget Interface
+
+	public:
+
+		virtual void Initialize() override {}
+
+		virtual uint32 GetWidth() const override;
+
+		virtual uint32 GetHeight() const override;
+
+#if WITH_RIVE
+
+		virtual void Submit() override;
+
+		virtual void SubmitAndClear() override;
+
+		virtual void Draw(rive::Artboard* InArtboard, FCriticalSection* InArtboardCS) override {}
+
+		virtual void DrawPath(rive::RenderPath* InPath, rive::RenderPaint* InPaint) override {}
+
+		virtual void ClipPath(rive::RenderPath* InPath) override {}
+
+		virtual void DrawAtlasEntry(const IRiveRenderTargetRef& InEntryTarget, const FIntPoint& InOffset) override {}
+
+#endif // WITH_RIVE
+
+		//~ END : IRiveRenderTarget Interface
+
+		//~ BEGIN : FRiveRenderTarget Interface
+
+#if WITH_RIVE
+
+	protected:
+
+		virtual rive::rcp<rive::pls::PLSRenderTarget> GetRenderTarget() const override;
+
+#endif // WITH_RIVE
+
+		//~ END : FRiveRenderTarget Interface
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		/** Size of the atlas entries, the texture targets use the size of their texture */
+		FIntPoint Size = FIntPoint::ZeroValue;
+	};
+}
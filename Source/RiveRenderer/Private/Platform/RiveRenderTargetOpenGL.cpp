@@ -33,18 +33,17 @@ UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::FRiveRenderTargetOpenGL(co
 UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::~FRiveRenderTargetOpenGL()
 {
 	RIVE_DEBUG_FUNCTION_INDENT;
-	CachedPLSRenderTargetOpenGL.reset();
+	// Holds the framebuffer of the target, which can only be deleted on the Rive GL thread
+	RiveRenderer->ReleasePLSResource(std::move(CachedPLSRenderTargetOpenGL));
 }
 
 void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::Initialize()
 {
 	RIVE_DEBUG_FUNCTION_INDENT;
 	check(IsInGameThread());
-	
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
 
 	FTextureResource* RenderTargetResource = RenderTarget->GetResource();
-	if (IRiveRendererModule::RunInGameThread())
+	if (FRiveRendererOpenGL::RenderOnGameThread())
 	{
 		CacheTextureTarget_Internal(RenderTarget->GetResource()->TextureRHI);
 	}
@@ -64,7 +63,7 @@ void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::CacheTextureTarget_Re
 	RIVE_DEBUG_FUNCTION_INDENT;
 	check(IsInRenderingThread());
 
-	if (IRiveRendererModule::RunInGameThread())
+	if (FRiveRendererOpenGL::RenderOnGameThread())
 	{
 		AsyncTask(ENamedThreads::GameThread,[this, InTexture]()
 		{
@@ -81,18 +80,19 @@ void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::CacheTextureTarget_Re
 	}
 }
 
-void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::Submit()
+void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::SubmitCommandBuffer(FRiveRenderCommandBuffer&& InCommandBuffer)
 {
 	RIVE_DEBUG_FUNCTION_INDENT;
 	check(IsInGameThread());
 	
-	if (IRiveRendererModule::RunInGameThread())
+	if (FRiveRendererOpenGL::RenderOnGameThread())
 	{
-		Render_Internal(RenderCommands);
+		bOwnsGLFrame = true;
+		Render_Internal(*InCommandBuffer);
 	}
 	else
 	{
-		FRiveRenderTarget::Submit();
+		FRiveRenderTarget::SubmitCommandBuffer(MoveTemp(InCommandBuffer));
 	}
 }
 
@@ -104,7 +104,7 @@ rive::rcp<rive::pls::PLSRenderTarget> UE::Rive::Renderer::Private::FRiveRenderTa
 std::unique_ptr<rive::pls::PLSRenderer> UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::BeginFrame()
 {
 	RIVE_DEBUG_FUNCTION_INDENT;
-	check(IsInGameThread() || IsInRHIThread());
+	check(FRiveRendererOpenGL::IsInRiveGLThread());
 	ENABLE_VERIFY_GL_THREAD;
 
 	rive::pls::PLSRenderContext* PLSRenderContextPtr = RiveRenderer->GetPLSRenderContextPtr();
@@ -113,8 +113,10 @@ std::unique_ptr<rive::pls::PLSRenderer> UE::Rive::Renderer::Private::FRiveRender
 		return nullptr;
 	}
 	
-	RIVE_DEBUG_VERBOSE("PLSRenderContextGLImpl->resetGLState() %p", PLSRenderContextPtr);
-	PLSRenderContextPtr->static_impl_cast<rive::pls::PLSRenderContextGLImpl>()->invalidateGLState();
+	if (bOwnsGLFrame)
+	{
+		RiveRendererGL->BeginGLFrame_Internal();
+	}
 	
 	return FRiveRenderTarget::BeginFrame();
 }
@@ -122,7 +124,7 @@ std::unique_ptr<rive::pls::PLSRenderer> UE::Rive::Renderer::Private::FRiveRender
 void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::EndFrame() const
 {
 	RIVE_DEBUG_FUNCTION_INDENT;
-	check(IsInGameThread() || IsInRHIThread());
+	check(FRiveRendererOpenGL::IsInRiveGLThread());
 	ENABLE_VERIFY_GL_THREAD;
 	
 	rive::pls::PLSRenderContext* PLSRenderContextPtr = RiveRenderer->GetPLSRenderContextPtr();
@@ -139,70 +141,41 @@ void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::EndFrame() const
 		GetRenderTarget().get()
 	};
 	PLSRenderContextPtr->flush(FlushResources);
-
-	//todo: android texture blink if we don't call glReadPixels? to investigate
-	TArray<FIntVector2> Points{ {0,0}, { 100,100 }, { 200,200 }, { 300,300 }}; 
-	for (FIntVector2 Point : Points) 
+	
+	if (bOwnsGLFrame)
 	{
-		if (Point.X < GetWidth() && Point.Y < GetHeight())
-		{
-			GLubyte pix[4];
-			glReadPixels(Point.X, Point.Y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &pix);
-			RIVE_DEBUG_VERBOSE("Pixel [%d,%d] = %u %u %u %u", Point.X, Point.Y, pix[0], pix[1], pix[2], pix[3])
-		}
+		RiveRendererGL->EndGLFrame_Internal();
 	}
-	
-	// Reset
-	RIVE_DEBUG_VERBOSE("PLSRenderContextPtr->unbindGLInternalResources() %p", PLSRenderContextPtr);
-	PLSRenderContextPtr->static_impl_cast<rive::pls::PLSRenderContextGLImpl>()->unbindGLInternalResources();
 
-	if (IsInRHIThread()) //todo: still not working, to be looked at
+	if (FRiveRendererOpenGL::RenderOnGameThread())
 	{
-		FOpenGLDynamicRHI* OpenGLDynamicRHI = static_cast<FOpenGLDynamicRHI*>(GetIOpenGLDynamicRHI());
-		FOpenGLContextState& ContextState = OpenGLDynamicRHI->GetContextStateForCurrentContext(true);
-			
-		// UE_LOG(LogRiveRenderer, Display, TEXT("%s OpenGLDynamicRHI->RHIInvalidateCachedState()"), FDebugLogger::Ind(), PLSRenderContextPtr);
-		// OpenGLDynamicRHI->RHIInvalidateCachedState();
-
-		RIVE_DEBUG_VERBOSE("Pre RHIPostExternalCommandsReset");
-		// Manual reset of GL commands to match the GL State before Rive Commands. Supposed to be handled by RHIPostExternalCommandsReset, TBC
-		FOpenGL::BindProgramPipeline(ContextState.Program);
-		glViewport(ContextState.Viewport.Min.X, ContextState.Viewport.Min.Y, ContextState.Viewport.Max.X - ContextState.Viewport.Min.X, ContextState.Viewport.Max.Y - ContextState.Viewport.Min.Y);
-		FOpenGL::DepthRange(ContextState.DepthMinZ, ContextState.DepthMaxZ);
-		ContextState.bScissorEnabled ? glEnable(GL_SCISSOR_TEST) : glDisable(GL_SCISSOR_TEST);
-		glScissor(ContextState.Scissor.Min.X, ContextState.Scissor.Min.Y, ContextState.Scissor.Max.X - ContextState.Scissor.Min.X, ContextState.Scissor.Max.Y - ContextState.Scissor.Min.Y);
-		glBindFramebuffer(GL_FRAMEBUFFER, ContextState.Framebuffer);
-			
-		FOpenGL::PolygonMode(GL_FRONT_AND_BACK, ContextState.RasterizerState.FillMode);
-		glCullFace(ContextState.RasterizerState.CullMode);
-		glBindBuffer( GL_PIXEL_UNPACK_BUFFER, ContextState.PixelUnpackBufferBound);
-		glBindBuffer( GL_UNIFORM_BUFFER, ContextState.UniformBufferBound);
-		glBindBuffer( GL_SHADER_STORAGE_BUFFER, ContextState.StorageBufferBound);
-		glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, ContextState.ElementArrayBufferBound);
-		glBindBuffer( GL_ARRAY_BUFFER, ContextState.ArrayBufferBound);
-			
-		for (int i = 0; i < ContextState.Textures.Num(); i++)
+		// The texture is sampled from the context of the RHI, which waits on the GPU for this fence rather than on the CPU for a read back.
+		// The flush makes the fence visible to the other context.
+		GLsync TextureReadyFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		glFlush();
+		ENQUEUE_RENDER_COMMAND(WaitRiveTextureReady)(
+		[TextureReadyFence](FRHICommandListImmediate& RHICmdList)
 		{
-			glActiveTexture(GL_TEXTURE0 + i);
-			glBindTexture(GL_TEXTURE_2D, ContextState.Textures[i].Resource);
-		}
-		glActiveTexture(ContextState.ActiveTexture);
-		glFrontFace(GL_CCW);
-		
-		OpenGLDynamicRHI->RHIPostExternalCommandsReset();
-		
-		RIVE_DEBUG_VERBOSE("Post RHIPostExternalCommandsReset");
+			RHICmdList.EnqueueLambda([TextureReadyFence](FRHICommandListImmediate&)
+			{
+				glWaitSync(TextureReadyFence, 0, GL_TIMEOUT_IGNORED);
+				glDeleteSync(TextureReadyFence);
+			});
+		});
 	}
 }
 
-void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::Render_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FRiveRenderCommand>& RiveRenderCommands)
+void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::Render_RenderThread(FRHICommandListImmediate& RHICmdList, FRiveRenderCommandBuffer&& InCommandBuffer)
 {
 	RIVE_DEBUG_FUNCTION_INDENT;
 	check(IsInRenderingThread());
 	
-	RHICmdList.EnqueueLambda([this, RiveRenderCommands = RiveRenderCommands](FRHICommandListImmediate& RHICmdList)
+	// Within a render batch, the renderer sets up and restores the GL state once around all the targets
+	const bool bIsInRenderBatch = RiveRendererGL->IsInRenderBatch_RenderThread();
+	RHICmdList.EnqueueLambda([this, bIsInRenderBatch, CommandBuffer = MoveTemp(InCommandBuffer)](FRHICommandListImmediate& RHICmdList)
 	{
-		Render_Internal(RiveRenderCommands);
+		bOwnsGLFrame = !bIsInRenderBatch;
+		Render_Internal(*CommandBuffer);
 	});
 }
 
@@ -211,7 +184,7 @@ void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::Render_RenderThread(F
 void UE::Rive::Renderer::Private::FRiveRenderTargetOpenGL::CacheTextureTarget_Internal(const FTexture2DRHIRef& InRHIResource)
 {
 	RIVE_DEBUG_FUNCTION_INDENT;
-	check(IsInGameThread() || IsInRHIThread());
+	check(FRiveRendererOpenGL::IsInRiveGLThread());
 	ENABLE_VERIFY_GL_THREAD;
 
 	if (!ensure(FRiveRendererOpenGL::IsRHIOpenGL()) || !InRHIResource.IsValid())
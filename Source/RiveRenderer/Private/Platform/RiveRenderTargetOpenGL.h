@@ -41,14 +41,13 @@ namespace UE::Rive::Renderer::Private
 		//~ END : IRiveRenderTarget Interface
 
 		//~ BEGIN : FRiveRenderTarget Interface
-		virtual void Submit() override;
-
 	protected:
 		// It Might need to be on rendering thread, render QUEUE is required
 		virtual rive::rcp<rive::pls::PLSRenderTarget> GetRenderTarget() const override;
 		virtual std::unique_ptr<rive::pls::PLSRenderer> BeginFrame() override;
 		virtual void EndFrame() const override;
-		virtual void Render_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FRiveRenderCommand>& RiveRenderCommands) override;
+		virtual void SubmitCommandBuffer(FRiveRenderCommandBuffer&& InCommandBuffer) override;
+		virtual void Render_RenderThread(FRHICommandListImmediate& RHICmdList, FRiveRenderCommandBuffer&& InCommandBuffer) override;
 		//~ END : FRiveRenderTarget Interface
 		
 	private:
@@ -60,6 +59,8 @@ namespace UE::Rive::Renderer::Private
 		
 		rive::rcp<rive::pls::TextureRenderTargetGL> CachedPLSRenderTargetOpenGL;
 		TSharedPtr<FRiveRendererOpenGL> RiveRendererGL;
+		/** False while rendering within a render batch, the renderer then sets up and restores the GL state around all the targets instead */
+		bool bOwnsGLFrame = true;
 
 #endif // WITH_RIVE
 	};
@@ -100,4 +100,46 @@ void UE::Rive::Renderer::Private::FRiveRendererD3D11::ResetDXState() const
 	D3D11GPUAdapter->ResetDXState();
 }
 
+void UE::Rive::Renderer::Private::FRiveRendererD3D11::AddBatchedTarget_RenderThread(const FTextureRHIRef& InTexture, TUniqueFunction<void()>&& InRenderFunction)
+{
+	check(IsInRenderBatch_RenderThread());
+
+	BatchedTargets.Add({ InTexture, MoveTemp(InRenderFunction) });
+}
+
+void UE::Rive::Renderer::Private::FRiveRendererD3D11::EndRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	check(IsInRenderingThread());
+
+	if (BatchedTargets.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FRHITransitionInfo> ToRenderTargetTransitions;
+	TArray<FRHITransitionInfo> ToUAVTransitions;
+	ToRenderTargetTransitions.Reserve(BatchedTargets.Num());
+	ToUAVTransitions.Reserve(BatchedTargets.Num());
+	for (const FBatchedTarget& BatchedTarget : BatchedTargets)
+	{
+		ToRenderTargetTransitions.Emplace(BatchedTarget.Texture, ERHIAccess::Unknown, ERHIAccess::RTV);
+		ToUAVTransitions.Emplace(BatchedTarget.Texture, ERHIAccess::RTV, ERHIAccess::UAVGraphics);
+	}
+
+	RHICmdList.Transition(ToRenderTargetTransitions);
+	// ClearState is expensive, so the DX states are reset only once before and after all the targets of the batch
+	RHICmdList.EnqueueLambda([this, Targets = MoveTemp(BatchedTargets)](FRHICommandListImmediate& RHICmdList)
+	{
+		ResetDXState();
+		for (const FBatchedTarget& BatchedTarget : Targets)
+		{
+			BatchedTarget.RenderFunction();
+		}
+		ResetDXState();
+	});
+	RHICmdList.Transition(ToUAVTransitions);
+
+	BatchedTargets.Reset();
+}
+
 #endif // PLATFORM_WINDOWS
@@ -62,8 +62,23 @@ namespace UE::Rive::Renderer::Private
 		
 		void ResetDXState() const;
 
+		/** Queues the rendering of a target until the end of the current render batch, where all the queued targets are rendered back-to-back within a single DX state reset */
+		void AddBatchedTarget_RenderThread(const FTextureRHIRef& InTexture, TUniqueFunction<void()>&& InRenderFunction);
+
+		//~ BEGIN : FRiveRenderer Interface
+	protected:
+		virtual void EndRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList) override;
+		//~ END : FRiveRenderer Interface
+
 	private:
+		struct FBatchedTarget
+		{
+			FTextureRHIRef Texture;
+			TUniqueFunction<void()> RenderFunction;
+		};
+
 		TUniquePtr<UE::Rive::Renderer::Private::FRiveRendererD3D11GPUAdapter> D3D11GPUAdapter;
+		TArray<FBatchedTarget> BatchedTargets;
 	};
 }
 
@@ -21,6 +21,11 @@ THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 #include "Mac/AutoreleasePool.h"
 
+UE::Rive::Renderer::Private::FRiveRendererMetal::~FRiveRendererMetal()
+{
+    check(BatchCommandBuffer == nil);
+}
+
 TSharedPtr<UE::Rive::Renderer::IRiveRenderTarget> UE::Rive::Renderer::Private::FRiveRendererMetal::CreateTextureTarget_GameThread(const FName& InRiveName, UTexture2DDynamic* InRenderTarget)
 {
     check(IsInGameThread());
@@ -56,4 +61,39 @@ void UE::Rive::Renderer::Private::FRiveRendererMetal::CreatePLSContext_RenderThr
     }
 }
 
+void UE::Rive::Renderer::Private::FRiveRendererMetal::BeginRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+    check(IsInRenderingThread());
+    
+    BatchAutoreleasePool = MakeUnique<AutoreleasePool>();
+}
+
+void UE::Rive::Renderer::Private::FRiveRendererMetal::EndRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+    check(IsInRenderingThread());
+    
+    if (BatchCommandBuffer != nil)
+    {
+        // A single submission for all the targets of the batch
+        [BatchCommandBuffer commit];
+        [BatchCommandBuffer release];
+        BatchCommandBuffer = nil;
+    }
+    
+    BatchAutoreleasePool.Reset();
+}
+
+id<MTLCommandBuffer> UE::Rive::Renderer::Private::FRiveRendererMetal::GetBatchCommandBuffer_RenderThread()
+{
+    check(IsInRenderBatch_RenderThread());
+    
+    if (BatchCommandBuffer == nil)
+    {
+        id<MTLCommandQueue> MetalCommandQueue = (id<MTLCommandQueue>)GDynamicRHI->RHIGetNativeGraphicsQueue();
+        BatchCommandBuffer = [[MetalCommandQueue commandBuffer] retain];
+    }
+    
+    return BatchCommandBuffer;
+}
+
 #endif // PLATFORM_APPLE
@@ -7,6 +7,9 @@
 #if PLATFORM_APPLE
 
 #include "RiveRenderer.h"
+#include <Metal/Metal.h>
+
+class AutoreleasePool;
 
 #if WITH_RIVE
 
@@ -31,6 +34,9 @@ namespace UE::Rive::Renderer::Private
          */
         
     public:
+        
+        virtual ~FRiveRendererMetal() override;
+        
         //~ BEGIN : IRiveRenderer Interface
         
     public:
@@ -40,6 +46,37 @@ namespace UE::Rive::Renderer::Private
         virtual void CreatePLSContext_RenderThread(FRHICommandListImmediate& RHICmdList) override;
         
         //~ END : IRiveRenderer Interface
+
+        //~ BEGIN : FRiveRenderer Interface
+
+    protected:
+
+        virtual void BeginRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList) override;
+
+        virtual void EndRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList) override;
+
+        //~ END : FRiveRenderer Interface
+
+        /**
+         * Implementation(s)
+         */
+
+    public:
+
+        /** Returns the command buffer shared by all the targets of the current render batch, it is committed once at the end of the batch */
+        id<MTLCommandBuffer> GetBatchCommandBuffer_RenderThread();
+
+        /**
+         * Attribute(s)
+         */
+
+    private:
+
+        /** Retained until the end of the render batch, created by the first target rendered in the batch */
+        id<MTLCommandBuffer> BatchCommandBuffer = nil;
+
+        /** Drains the Metal objects autoreleased by all the targets of the render batch at once */
+        TUniquePtr<AutoreleasePool> BatchAutoreleasePool;
     };
 }
 
@@ -0,0 +1,42 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRendererNull.h"
+
+#include "Logs/RiveRendererLog.h"
+#include "RiveRenderTargetNull.h"
+
+void UE::Rive::Renderer::Private::FRiveRendererNull::Initialize()
+{
+	check(IsInGameThread());
+
+	{
+		FScopeLock Lock(&ThreadDataCS);
+		if (InitializationState != ERiveInitState::Uninitialized)
+		{
+			return;
+		}
+		// Nothing to create on the Render Thread, which may not even be running in a commandlet
+		InitializationState = ERiveInitState::Initialized;
+	}
+	OnInitializedDelegate.Broadcast(this);
+}
+
+UE::Rive::Renderer::IRiveRenderTargetPtr UE::Rive::Renderer::Private::FRiveRendererNull::CreateTextureTarget_GameThread(const FName& InRiveName, UTexture2DDynamic* InRenderTarget)
+{
+	check(IsInGameThread());
+
+	FScopeLock Lock(&ThreadDataCS);
+
+	const TSharedPtr<FRiveRenderTargetNull> RiveRenderTarget = MakeShared<FRiveRenderTargetNull>(SharedThis(this), InRiveName, InRenderTarget);
+
+	RenderTargets.Add(InRiveName, RiveRenderTarget);
+
+	return RiveRenderTarget;
+}
+
+UE::Rive::Renderer::IRiveRenderTargetPtr UE::Rive::Renderer::Private::FRiveRendererNull::CreateAtlasEntryTarget_GameThread(const FName& InRiveName, const FIntPoint& InSize)
+{
+	check(IsInGameThread());
+
+	return MakeShared<FRiveRenderTargetNull>(SharedThis(this), InRiveName, InSize);
+}
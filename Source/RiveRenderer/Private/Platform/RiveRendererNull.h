@@ -0,0 +1,37 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "RiveRenderer.h"
+
+namespace UE::Rive::Renderer::Private
+{
+	/**
+	 * Renderer used without a GPU (Null RHI, dedicated servers and commandlets). The Rive Files are still imported with the renderer factory,
+	 * so their Artboards, State Machines and Events keep running, but there is no PLSRenderContext and its targets drop every draw.
+	 */
+	class RIVERENDERER_API FRiveRendererNull : public FRiveRenderer
+	{
+		//~ BEGIN : IRiveRenderer Interface
+
+	public:
+
+		virtual void Initialize() override;
+
+		virtual bool IsRendering() const override { return false; }
+
+		virtual IRiveRenderTargetPtr CreateTextureTarget_GameThread(const FName& InRiveName, UTexture2DDynamic* InRenderTarget) override;
+
+		virtual IRiveRenderTargetPtr CreateAtlasEntryTarget_GameThread(const FName& InRiveName, const FIntPoint& InSize) override;
+
+		virtual void CreatePLSContext_RenderThread(FRHICommandListImmediate& RHICmdList) override {}
+
+#if WITH_RIVE
+
+		virtual rive::pls::PLSRenderContext* GetPLSRenderContextPtr() override { return nullptr; }
+
+#endif // WITH_RIVE
+
+		//~ END : IRiveRenderer Interface
+	};
+}
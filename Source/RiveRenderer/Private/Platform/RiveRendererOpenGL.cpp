@@ -7,6 +7,7 @@
 
 #include "Async/Async.h"
 #include "DynamicRHI.h"
+#include "IOpenGLDynamicRHI.h"
 #include "IRiveRendererModule.h"
 #include "Logs/RiveRendererLog.h"
 #include "OpenGLDrv.h"
@@ -22,33 +23,54 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 
+static TAutoConsoleVariable<bool> CVarRiveOpenGLRenderOnGameThread(
+	TEXT("Rive.OpenGL.RenderOnGameThread"),
+	false,
+	TEXT("If true, Rive renders on the Game Thread in its own GL context instead of on the RHI Thread, and the RHI waits on a GL fence before sampling the textures.\n")
+	TEXT("Fallback for the devices where rendering in the context of the RHI misbehaves, the Game Thread then pays for the GPU encoding."),
+	ECVF_ReadOnly);
+
 // ---------------------------------------------------
 // --------------- FRiveRendererOpenGL ---------------
 // ---------------------------------------------------
 
-void UE::Rive::Renderer::Private::FRiveRendererOpenGL::Initialize()
+UE::Rive::Renderer::Private::FRiveRendererOpenGL::~FRiveRendererOpenGL()
 {
-	check(IsInGameThread());
-	RIVE_DEBUG_FUNCTION_INDENT
-	
+	RIVE_DEBUG_FUNCTION_INDENT;
+
+#if WITH_RIVE
+	if (!RenderOnGameThread() && !IsRunningCommandlet())
 	{
-		FString glVersionStr = ANSI_TO_TCHAR((const ANSICHAR*) glGetString(GL_VERSION));
-		RIVE_DEBUG_VERBOSE("GAMETHREAD: glVersionStr %s", *glVersionStr);
-            
-		ENQUEUE_RENDER_COMMAND(URiveFileInitialize_RenderThread)(
-		[](FRHICommandListImmediate& RHICmdList)
+		std::unique_ptr<rive::pls::PLSRenderContext> PLSRenderContextToRelease;
+		{
+			FScopeLock Lock(&ContextsCS);
+			PLSRenderContextToRelease = std::move(PLSRenderContext);
+		}
+
+		if (PLSRenderContextToRelease)
 		{
-			FString glVersionStr = ANSI_TO_TCHAR((const ANSICHAR*) glGetString(GL_VERSION));
-			RIVE_DEBUG_VERBOSE("RENDERTHREAD: glVersionStr %s", *glVersionStr);
-			RHICmdList.EnqueueLambda([](FRHICommandListImmediate&)
+			// The context lives in the GL context of the RHI, the base destructor would release it on the Game Thread
+			ENQUEUE_RENDER_COMMAND(ReleaseRivePLSContext)(
+			[PLSRenderContextToRelease = std::move(PLSRenderContextToRelease)](FRHICommandListImmediate& RHICmdList) mutable
 			{
-				FString glVersionStr = ANSI_TO_TCHAR((const ANSICHAR*) glGetString(GL_VERSION));
-				RIVE_DEBUG_VERBOSE("RHITHREAD: glVersionStr %s", *glVersionStr);
+				RHICmdList.EnqueueLambda([PLSRenderContextToRelease = std::move(PLSRenderContextToRelease)](FRHICommandListImmediate&) mutable
+				{
+					PLSRenderContextToRelease->releaseResources();
+					PLSRenderContextToRelease.reset();
+				});
 			});
-		});
+			FlushRenderingCommands();
+		}
 	}
+#endif // WITH_RIVE
+}
 
-	if (IRiveRendererModule::RunInGameThread())
+void UE::Rive::Renderer::Private::FRiveRendererOpenGL::Initialize()
+{
+	check(IsInGameThread());
+	RIVE_DEBUG_FUNCTION_INDENT
+
+	if (RenderOnGameThread())
 	{
 		{
 			FScopeLock Lock(&ThreadDataCS);
@@ -123,7 +145,7 @@ void UE::Rive::Renderer::Private::FRiveRendererOpenGL::CreatePLSContext_GameThre
 rive::pls::PLSRenderContext* UE::Rive::Renderer::Private::FRiveRendererOpenGL::GetOrCreatePLSRenderContextPtr_Internal()
 {
 	RIVE_DEBUG_FUNCTION_INDENT;
-	check(IsInGameThread() || IsInRHIThread());
+	check(IsInRiveGLThread());
 	ENABLE_VERIFY_GL_THREAD;
 	
 	if (ensure(IsRHIOpenGL()))
@@ -135,6 +157,8 @@ rive::pls::PLSRenderContext* UE::Rive::Renderer::Private::FRiveRendererOpenGL::G
 			return PLSRenderContext.get();
 		}
 		
+		// Only the Rive GL thread has a current context, glGetString returns null anywhere else
+		RIVE_DEBUG_VERBOSE("glVersionStr %s", ANSI_TO_TCHAR((const ANSICHAR*) glGetString(GL_VERSION)));
 		DebugLogOpenGLStatus();
 		
 		RIVE_DEBUG_VERBOSE("--- OpenGL Console Variables ---");
@@ -176,11 +200,147 @@ rive::pls::PLSRenderContext* UE::Rive::Renderer::Private::FRiveRendererOpenGL::G
 	return nullptr;
 }
 
+void UE::Rive::Renderer::Private::FRiveRendererOpenGL::BeginGLFrame_Internal()
+{
+	RIVE_DEBUG_FUNCTION_INDENT;
+	check(IsInRiveGLThread());
+
+	if (rive::pls::PLSRenderContext* PLSRenderContextPtr = GetPLSRenderContextPtr())
+	{
+		RIVE_DEBUG_VERBOSE("PLSRenderContextGLImpl->invalidateGLState() %p", PLSRenderContextPtr);
+		PLSRenderContextPtr->static_impl_cast<rive::pls::PLSRenderContextGLImpl>()->invalidateGLState();
+	}
+}
+
+rive::rcp<rive::pls::PLSTexture> UE::Rive::Renderer::Private::FRiveRendererOpenGL::MakeImageTexture(uint32 InWidth, uint32 InHeight, uint32 InMipLevelCount, const uint8* InImageDataRGBA)
+{
+	check(IsInRiveGLThread());
+
+	rive::pls::PLSRenderContext* PLSRenderContextPtr = GetPLSRenderContextPtr();
+	if (!PLSRenderContextPtr)
+	{
+		return nullptr;
+	}
+
+	if (!RenderOnGameThread())
+	{
+		// The upload reads from client memory, while the RHI may have left a pixel unpack buffer or a row length bound. EndGLFrame_Internal restores the buffer
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	}
+
+	return PLSRenderContextPtr->static_impl_cast<rive::pls::PLSRenderContextGLImpl>()->makeImageTexture(InWidth, InHeight, InMipLevelCount, InImageDataRGBA);
+}
+
+void UE::Rive::Renderer::Private::FRiveRendererOpenGL::EnqueuePLSResourceRelease(TUniqueFunction<void()>&& InRelease)
+{
+	if (RenderOnGameThread())
+	{
+		AsyncTask(ENamedThreads::GameThread, MoveTemp(InRelease));
+		return;
+	}
+
+	ENQUEUE_RENDER_COMMAND(ReleaseRivePLSResource)(
+	[Release = MoveTemp(InRelease)](FRHICommandListImmediate& RHICmdList) mutable
+	{
+		RHICmdList.EnqueueLambda([Release = MoveTemp(Release)](FRHICommandListImmediate&) mutable
+		{
+			Release();
+		});
+	});
+}
+
+void UE::Rive::Renderer::Private::FRiveRendererOpenGL::EndGLFrame_Internal()
+{
+	RIVE_DEBUG_FUNCTION_INDENT;
+	check(IsInRiveGLThread());
+
+	if (rive::pls::PLSRenderContext* PLSRenderContextPtr = GetPLSRenderContextPtr())
+	{
+		RIVE_DEBUG_VERBOSE("PLSRenderContextPtr->unbindGLInternalResources() %p", PLSRenderContextPtr);
+		PLSRenderContextPtr->static_impl_cast<rive::pls::PLSRenderContextGLImpl>()->unbindGLInternalResources();
+	}
+
+	if (RenderOnGameThread())
+	{
+		// Rive has its own context, there is no state of the RHI to restore
+		return;
+	}
+
+	FOpenGLDynamicRHI* OpenGLDynamicRHI = static_cast<FOpenGLDynamicRHI*>(GetIOpenGLDynamicRHI());
+	FOpenGLContextState& ContextState = OpenGLDynamicRHI->GetContextStateForCurrentContext(true);
+		
+	RIVE_DEBUG_VERBOSE("Pre RHIPostExternalCommandsReset");
+	// Manual reset of GL commands to match the GL State before Rive Commands. Supposed to be handled by RHIPostExternalCommandsReset, TBC
+	FOpenGL::BindProgramPipeline(ContextState.Program);
+	glViewport(ContextState.Viewport.Min.X, ContextState.Viewport.Min.Y, ContextState.Viewport.Max.X - ContextState.Viewport.Min.X, ContextState.Viewport.Max.Y - ContextState.Viewport.Min.Y);
+	FOpenGL::DepthRange(ContextState.DepthMinZ, ContextState.DepthMaxZ);
+	ContextState.bScissorEnabled ? glEnable(GL_SCISSOR_TEST) : glDisable(GL_SCISSOR_TEST);
+	glScissor(ContextState.Scissor.Min.X, ContextState.Scissor.Min.Y, ContextState.Scissor.Max.X - ContextState.Scissor.Min.X, ContextState.Scissor.Max.Y - ContextState.Scissor.Min.Y);
+	glBindFramebuffer(GL_FRAMEBUFFER, ContextState.Framebuffer);
+		
+	FOpenGL::PolygonMode(GL_FRONT_AND_BACK, ContextState.RasterizerState.FillMode);
+	glCullFace(ContextState.RasterizerState.CullMode);
+	glBindBuffer( GL_PIXEL_UNPACK_BUFFER, ContextState.PixelUnpackBufferBound);
+	glBindBuffer( GL_UNIFORM_BUFFER, ContextState.UniformBufferBound);
+	glBindBuffer( GL_SHADER_STORAGE_BUFFER, ContextState.StorageBufferBound);
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, ContextState.ElementArrayBufferBound);
+	glBindBuffer( GL_ARRAY_BUFFER, ContextState.ArrayBufferBound);
+		
+	for (int i = 0; i < ContextState.Textures.Num(); i++)
+	{
+		glActiveTexture(GL_TEXTURE0 + i);
+		glBindTexture(GL_TEXTURE_2D, ContextState.Textures[i].Resource);
+	}
+	glActiveTexture(ContextState.ActiveTexture);
+	glFrontFace(GL_CCW);
+	
+	OpenGLDynamicRHI->RHIPostExternalCommandsReset();
+	
+	RIVE_DEBUG_VERBOSE("Post RHIPostExternalCommandsReset");
+}
+
+void UE::Rive::Renderer::Private::FRiveRendererOpenGL::BeginRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	if (!RenderOnGameThread())
+	{
+		RHICmdList.EnqueueLambda([this](FRHICommandListImmediate&)
+		{
+			BeginGLFrame_Internal();
+		});
+	}
+}
+
+void UE::Rive::Renderer::Private::FRiveRendererOpenGL::EndRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	if (!RenderOnGameThread())
+	{
+		RHICmdList.EnqueueLambda([this](FRHICommandListImmediate&)
+		{
+			EndGLFrame_Internal();
+		});
+	}
+}
+
 bool UE::Rive::Renderer::Private::FRiveRendererOpenGL::IsRHIOpenGL()
 {
 	return GDynamicRHI != nullptr && GDynamicRHI->GetInterfaceType() == ERHIInterfaceType::OpenGL;
 }
 
+bool UE::Rive::Renderer::Private::FRiveRendererOpenGL::RenderOnGameThread()
+{
+	return CVarRiveOpenGLRenderOnGameThread.GetValueOnAnyThread();
+}
+
+bool UE::Rive::Renderer::Private::FRiveRendererOpenGL::IsInRiveGLThread()
+{
+	if (RenderOnGameThread())
+	{
+		return IsInGameThread();
+	}
+	return IsRunningRHIInSeparateThread() ? IsInRHIThread() : IsInRenderingThread();
+}
+
 
 void UE::Rive::Renderer::Private::FRiveRendererOpenGL::DebugLogOpenGLStatus()
 {
@@ -35,6 +35,7 @@ namespace UE::Rive::Renderer::Private
 		 * Structor(s)
 		 */
 	public:
+		virtual ~FRiveRendererOpenGL() override;
 		
 		//~ BEGIN : IRiveRenderer Interface
 	public:
@@ -47,8 +48,25 @@ namespace UE::Rive::Renderer::Private
 		//~ END : IRiveRenderer Interface
 		
 		virtual rive::pls::PLSRenderContext* GetOrCreatePLSRenderContextPtr_Internal();
+		/** Makes PLS forget the GL state it cached, the RHI having changed it since Rive last rendered */
+		void BeginGLFrame_Internal();
+		/** Unbinds the resources of PLS and restores the GL state cached by the RHI */
+		void EndGLFrame_Internal();
+		/** Rive files imported on other threads, e.g. by workers, have their image textures created at replay */
+		virtual bool CanCreatePLSResources() const override { return IsInRiveGLThread(); }
+		virtual rive::rcp<rive::pls::PLSTexture> MakeImageTexture(uint32 InWidth, uint32 InHeight, uint32 InMipLevelCount, const uint8* InImageDataRGBA) override;
+	protected:
+		virtual void BeginRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList) override;
+		virtual void EndRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList) override;
+		/** Runs the release on the GL thread, where the PLS resources created by Rive can be deleted */
+		virtual void EnqueuePLSResourceRelease(TUniqueFunction<void()>&& InRelease) override;
+	public:
 #endif // WITH_RIVE
 		static bool IsRHIOpenGL();
+		/** Returns true if Rive.OpenGL.RenderOnGameThread is set, Rive then renders in its own GL context on the Game Thread */
+		static bool RenderOnGameThread();
+		/** Returns true on the thread issuing the GL commands of Rive: the RHI Thread, the Rendering Thread when there is no RHI Thread, or the Game Thread if RenderOnGameThread */
+		static bool IsInRiveGLThread();
 	private:
 		mutable FCriticalSection ContextsCS;
 
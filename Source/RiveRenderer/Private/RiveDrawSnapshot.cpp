@@ -0,0 +1,158 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveDrawSnapshot.h"
+
+#if WITH_RIVE
+
+#include "RiveRenderFactory.h"
+#include "Stats/RiveRendererStats.h"
+
+namespace UE::Rive::Renderer::Private
+{
+	/** Images deferred by FRiveRenderFactory are drawn through the PLS Image they create at replay */
+	static const rive::RenderImage* GetImageToDraw(const rive::RenderImage* InImage)
+	{
+		if (const FRiveRenderImage* RenderImage = rive::lite_rtti_cast<const FRiveRenderImage*>(InImage))
+		{
+			return RenderImage->GetPLSImage();
+		}
+
+		return InImage;
+	}
+}
+
+void UE::Rive::Renderer::Private::FRiveDrawSnapshot::Draw(rive::Renderer* InRenderer) const
+{
+	for (const FRiveDrawSnapshotCommand& Command : Commands)
+	{
+		switch (Command.Type)
+		{
+		case ERiveDrawSnapshotCommandType::Save:
+			InRenderer->save();
+			break;
+		case ERiveDrawSnapshotCommandType::Restore:
+			InRenderer->restore();
+			break;
+		case ERiveDrawSnapshotCommandType::Transform:
+			InRenderer->transform(Command.Transform);
+			break;
+		case ERiveDrawSnapshotCommandType::DrawPath:
+			InRenderer->drawPath(Command.Path.get(), Command.Paint.get());
+			break;
+		case ERiveDrawSnapshotCommandType::ClipPath:
+			InRenderer->clipPath(Command.Path.get());
+			break;
+		case ERiveDrawSnapshotCommandType::DrawImage:
+			InRenderer->drawImage(GetImageToDraw(Command.Image.get()), Command.BlendMode, Command.Opacity);
+			break;
+		case ERiveDrawSnapshotCommandType::DrawImageMesh:
+			InRenderer->drawImageMesh(GetImageToDraw(Command.Image.get()),
+				Command.Vertices ? Command.Vertices->GetPLSBuffer() : nullptr,
+				Command.UVCoords ? Command.UVCoords->GetPLSBuffer() : nullptr,
+				Command.Indices ? Command.Indices->GetPLSBuffer() : nullptr,
+				Command.VertexCount, Command.IndexCount, Command.BlendMode, Command.Opacity);
+			break;
+		}
+	}
+}
+
+TSharedRef<UE::Rive::Renderer::Private::FRiveDrawSnapshot> UE::Rive::Renderer::Private::FRiveDrawSnapshotPool::Acquire()
+{
+	check(IsInGameThread());
+
+	for (const TSharedRef<FRiveDrawSnapshot>& Snapshot : Snapshots)
+	{
+		// Only the pool references it, nothing else can get a new reference to it
+		if (Snapshot.GetSharedReferenceCount() == 1)
+		{
+			Snapshot->Commands.Reset();
+			return Snapshot;
+		}
+	}
+
+	INC_DWORD_STAT(STAT_RiveRendererDrawSnapshotAllocations);
+	TSharedRef<FRiveDrawSnapshot> Snapshot = MakeShared<FRiveDrawSnapshot>();
+	if (Snapshots.Num() < MaxSnapshots)
+	{
+		Snapshots.Add(Snapshot);
+	}
+
+	return Snapshot;
+}
+
+UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::FRiveDrawSnapshotRecorder(FRiveRenderFactory& InRenderFactory, const TSharedRef<FRiveDrawSnapshot>& InSnapshot, int32 InExpectedNumCommands)
+	: RenderFactory(InRenderFactory)
+	, Snapshot(InSnapshot)
+{
+	check(Snapshot->Commands.IsEmpty());
+	Snapshot->Commands.Reserve(InExpectedNumCommands);
+}
+
+void UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::save()
+{
+	AddCommand(ERiveDrawSnapshotCommandType::Save);
+}
+
+void UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::restore()
+{
+	AddCommand(ERiveDrawSnapshotCommandType::Restore);
+}
+
+void UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::transform(const rive::Mat2D& InTransform)
+{
+	AddCommand(ERiveDrawSnapshotCommandType::Transform).Transform = InTransform;
+}
+
+void UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::drawPath(rive::RenderPath* InPath, rive::RenderPaint* InPaint)
+{
+	FRiveDrawSnapshotCommand& Command = AddCommand(ERiveDrawSnapshotCommandType::DrawPath);
+	Command.Path = RenderFactory.FreezePath(InPath);
+	Command.Paint = RenderFactory.FreezePaint(InPaint);
+}
+
+void UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::clipPath(rive::RenderPath* InPath)
+{
+	AddCommand(ERiveDrawSnapshotCommandType::ClipPath).Path = RenderFactory.FreezePath(InPath);
+}
+
+void UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::drawImage(const rive::RenderImage* InImage, rive::BlendMode InBlendMode, float InOpacity)
+{
+	FRiveDrawSnapshotCommand& Command = AddCommand(ERiveDrawSnapshotCommandType::DrawImage);
+	Command.Image = rive::ref_rcp(InImage);
+	Command.BlendMode = InBlendMode;
+	Command.Opacity = InOpacity;
+}
+
+void UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::drawImageMesh(const rive::RenderImage* InImage,
+                                                                          rive::rcp<rive::RenderBuffer> InVertices,
+                                                                          rive::rcp<rive::RenderBuffer> InUVCoords,
+                                                                          rive::rcp<rive::RenderBuffer> InIndices,
+                                                                          uint32_t InVertexCount,
+                                                                          uint32_t InIndexCount,
+                                                                          rive::BlendMode InBlendMode,
+                                                                          float InOpacity)
+{
+	FRiveDrawSnapshotCommand& Command = AddCommand(ERiveDrawSnapshotCommandType::DrawImageMesh);
+	Command.Image = rive::ref_rcp(InImage);
+	Command.Vertices = RenderFactory.FreezeBuffer(InVertices.get());
+	Command.UVCoords = RenderFactory.FreezeBuffer(InUVCoords.get());
+	Command.Indices = RenderFactory.FreezeBuffer(InIndices.get());
+	Command.VertexCount = InVertexCount;
+	Command.IndexCount = InIndexCount;
+	Command.BlendMode = InBlendMode;
+	Command.Opacity = InOpacity;
+}
+
+TSharedRef<const UE::Rive::Renderer::Private::FRiveDrawSnapshot> UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::Finish()
+{
+	return Snapshot;
+}
+
+UE::Rive::Renderer::Private::FRiveDrawSnapshotCommand& UE::Rive::Renderer::Private::FRiveDrawSnapshotRecorder::AddCommand(ERiveDrawSnapshotCommandType InType)
+{
+	FRiveDrawSnapshotCommand& Command = Snapshot->Commands.AddDefaulted_GetRef();
+	Command.Type = InType;
+	return Command;
+}
+
+#endif // WITH_RIVE
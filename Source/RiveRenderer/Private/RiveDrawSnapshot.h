@@ -0,0 +1,178 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_RIVE
+
+#include "RiveCore/Public/PreRiveHeaders.h"
+THIRD_PARTY_INCLUDES_START
+#include "rive/renderer.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace UE::Rive::Renderer::Private
+{
+	class FRiveFrozenRenderBuffer;
+	class FRiveRenderFactory;
+
+	enum class ERiveDrawSnapshotCommandType : uint8
+	{
+		Save,
+		Restore,
+		Transform,
+		DrawPath,
+		ClipPath,
+		DrawImage,
+		DrawImageMesh
+	};
+
+	struct FRiveDrawSnapshotCommand
+	{
+		ERiveDrawSnapshotCommandType Type = ERiveDrawSnapshotCommandType::Save;
+
+		rive::BlendMode BlendMode = rive::BlendMode::srcOver;
+
+		uint32 VertexCount = 0;
+
+		uint32 IndexCount = 0;
+
+		float Opacity = 1.f;
+
+		rive::Mat2D Transform;
+
+		rive::rcp<rive::RenderPath> Path;
+
+		rive::rcp<rive::RenderPaint> Paint;
+
+		rive::rcp<const rive::RenderImage> Image;
+
+		TSharedPtr<FRiveFrozenRenderBuffer> Vertices;
+
+		TSharedPtr<FRiveFrozenRenderBuffer> UVCoords;
+
+		TSharedPtr<FRiveFrozenRenderBuffer> Indices;
+	};
+
+	/**
+	 * Immutable draw list of an Artboard, recorded on the Game Thread by FRiveDrawSnapshotRecorder.
+	 * It only references frozen Paths, Paints and Buffers, so the Render Thread can replay it while the Game Thread keeps advancing the Artboard.
+	 */
+	class FRiveDrawSnapshot
+	{
+		friend class FRiveDrawSnapshotRecorder;
+		friend class FRiveDrawSnapshotPool;
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		void Draw(rive::Renderer* InRenderer) const;
+
+		int32 Num() const { return Commands.Num(); }
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		TArray<FRiveDrawSnapshotCommand> Commands;
+	};
+
+	/**
+	 * Snapshots recycled by the Render Target recording them, Game Thread only.
+	 * A snapshot is reused once the pool holds its last reference, i.e. once the command buffers replaying it were released by the Render Thread.
+	 * Its commands keep their capacity, so recording an Artboard does not allocate once the pool is warm.
+	 */
+	class FRiveDrawSnapshotPool
+	{
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		/** Returns an empty snapshot to record into */
+		TSharedRef<FRiveDrawSnapshot> Acquire();
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		/** Enough for a few Artboards drawn per frame with a couple of frames in flight, snapshots acquired past it are not recycled */
+		static constexpr int32 MaxSnapshots = 8;
+
+		TArray<TSharedRef<FRiveDrawSnapshot>, TInlineAllocator<MaxSnapshots>> Snapshots;
+	};
+
+	/**
+	 * Renderer recording the draws of an Artboard into a FRiveDrawSnapshot, the Artboard must have been imported with the given FRiveRenderFactory.
+	 */
+	class FRiveDrawSnapshotRecorder : public rive::Renderer
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		FRiveDrawSnapshotRecorder(FRiveRenderFactory& InRenderFactory, const TSharedRef<FRiveDrawSnapshot>& InSnapshot, int32 InExpectedNumCommands);
+
+		//~ BEGIN : rive::Renderer Interface
+
+	public:
+
+		virtual void save() override;
+
+		virtual void restore() override;
+
+		virtual void transform(const rive::Mat2D& InTransform) override;
+
+		virtual void drawPath(rive::RenderPath* InPath, rive::RenderPaint* InPaint) override;
+
+		virtual void clipPath(rive::RenderPath* InPath) override;
+
+		virtual void drawImage(const rive::RenderImage* InImage, rive::BlendMode InBlendMode, float InOpacity) override;
+
+		virtual void drawImageMesh(const rive::RenderImage* InImage,
+		                           rive::rcp<rive::RenderBuffer> InVertices,
+		                           rive::rcp<rive::RenderBuffer> InUVCoords,
+		                           rive::rcp<rive::RenderBuffer> InIndices,
+		                           uint32_t InVertexCount,
+		                           uint32_t InIndexCount,
+		                           rive::BlendMode InBlendMode,
+		                           float InOpacity) override;
+
+		//~ END : rive::Renderer Interface
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		/** Returns the recorded snapshot, the recorder must not be used afterwards */
+		TSharedRef<const FRiveDrawSnapshot> Finish();
+
+	private:
+
+		FRiveDrawSnapshotCommand& AddCommand(ERiveDrawSnapshotCommandType InType);
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		FRiveRenderFactory& RenderFactory;
+
+		TSharedRef<FRiveDrawSnapshot> Snapshot;
+	};
+}
+
+#endif // WITH_RIVE
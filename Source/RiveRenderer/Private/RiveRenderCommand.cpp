@@ -19,7 +19,7 @@ rive::Mat2D FRiveRenderCommand::GetSaved2DTransform() const
 			static_cast<rive::Fit>(FitType),
 			rive::Alignment(X, Y),
 			rive::AABB(TX, TY, X2, Y2),
-			NativeArtboard->bounds());
+			rive::AABB(ArtboardBounds.Min.X, ArtboardBounds.Min.Y, ArtboardBounds.Max.X, ArtboardBounds.Max.Y));
 	case ERiveRenderCommandType::Translate:
 		return rive::Mat2D(1.f, 0.f, 0.f, 1.f, TX, TY);
 	default: ;
@@ -0,0 +1,73 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRenderCommandBuffer.h"
+
+#if WITH_RIVE
+
+#include "Stats/RiveRendererStats.h"
+
+UE::Rive::Renderer::Private::FRiveRenderCommandBuffer::FRiveRenderCommandBuffer(const TSharedRef<FRiveRenderCommandBufferPool, ESPMode::ThreadSafe>& InPool, TUniquePtr<FRiveRenderCommandStream>&& InCommands)
+	: Pool(InPool)
+	, Commands(MoveTemp(InCommands))
+{
+}
+
+UE::Rive::Renderer::Private::FRiveRenderCommandBuffer& UE::Rive::Renderer::Private::FRiveRenderCommandBuffer::operator=(FRiveRenderCommandBuffer&& Other)
+{
+	if (this != &Other)
+	{
+		Release();
+		Pool = MoveTemp(Other.Pool);
+		Commands = MoveTemp(Other.Commands);
+	}
+	return *this;
+}
+
+UE::Rive::Renderer::Private::FRiveRenderCommandBuffer::~FRiveRenderCommandBuffer()
+{
+	Release();
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandBuffer::Release()
+{
+	if (Pool && Commands)
+	{
+		Pool->Release(MoveTemp(Commands));
+	}
+	Pool.Reset();
+	Commands.Reset();
+}
+
+UE::Rive::Renderer::Private::FRiveRenderCommandBuffer UE::Rive::Renderer::Private::FRiveRenderCommandBufferPool::Acquire()
+{
+	TUniquePtr<FRiveRenderCommandStream> Commands;
+	{
+		FScopeLock Lock(&FreeBuffersCS);
+		if (!FreeBuffers.IsEmpty())
+		{
+			Commands = FreeBuffers.Pop();
+		}
+	}
+
+	if (!Commands)
+	{
+		INC_DWORD_STAT(STAT_RiveRendererCommandBufferAllocations);
+		Commands = MakeUnique<FRiveRenderCommandStream>();
+	}
+
+	return FRiveRenderCommandBuffer(AsShared(), MoveTemp(Commands));
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandBufferPool::Release(TUniquePtr<FRiveRenderCommandStream>&& InCommands)
+{
+	// Destroying the commands releases their snapshots, which is done outside of the lock
+	InCommands->Reset();
+
+	FScopeLock Lock(&FreeBuffersCS);
+	if (FreeBuffers.Num() < MaxFreeBuffers)
+	{
+		FreeBuffers.Add(MoveTemp(InCommands));
+	}
+}
+
+#endif // WITH_RIVE
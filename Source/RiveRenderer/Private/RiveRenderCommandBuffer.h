@@ -0,0 +1,105 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_RIVE
+
+#include "RiveRenderCommandStream.h"
+
+namespace UE::Rive::Renderer::Private
+{
+	class FRiveRenderCommandBufferPool;
+
+	/**
+	 * Move-only handle on a command stream of a FRiveRenderCommandBufferPool, the stream goes back to its pool when the handle is destroyed.
+	 * It is moved from the Game Thread recording the commands to the thread executing them, so the commands are never copied.
+	 */
+	class FRiveRenderCommandBuffer
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		FRiveRenderCommandBuffer() = default;
+
+		FRiveRenderCommandBuffer(const TSharedRef<FRiveRenderCommandBufferPool, ESPMode::ThreadSafe>& InPool, TUniquePtr<FRiveRenderCommandStream>&& InCommands);
+
+		FRiveRenderCommandBuffer(FRiveRenderCommandBuffer&& Other) = default;
+
+		FRiveRenderCommandBuffer& operator=(FRiveRenderCommandBuffer&& Other);
+
+		FRiveRenderCommandBuffer(const FRiveRenderCommandBuffer&) = delete;
+
+		FRiveRenderCommandBuffer& operator=(const FRiveRenderCommandBuffer&) = delete;
+
+		~FRiveRenderCommandBuffer();
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		bool IsValid() const { return Commands.IsValid(); }
+
+		FRiveRenderCommandStream& operator*() const { check(Commands); return *Commands; }
+
+		FRiveRenderCommandStream* operator->() const { check(Commands); return Commands.Get(); }
+
+	private:
+
+		void Release();
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		TSharedPtr<FRiveRenderCommandBufferPool, ESPMode::ThreadSafe> Pool;
+
+		TUniquePtr<FRiveRenderCommandStream> Commands;
+	};
+
+	/**
+	 * Command streams recycled between the Game Thread, which acquires and fills them, and the Render or RHI Thread, which releases them once executed.
+	 * A released stream keeps its capacity, so once the pool holds as many streams as there are frames in flight, submitting does not allocate anymore.
+	 */
+	class FRiveRenderCommandBufferPool : public TSharedFromThis<FRiveRenderCommandBufferPool, ESPMode::ThreadSafe>
+	{
+		friend class FRiveRenderCommandBuffer;
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		/** Returns an empty buffer, a new one is only allocated if all the pooled ones are still in flight */
+		FRiveRenderCommandBuffer Acquire();
+
+	private:
+
+		/** Thread safe, the commands are destroyed before the stream is pooled again */
+		void Release(TUniquePtr<FRiveRenderCommandStream>&& InCommands);
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		/** More than this many idle streams means the number of frames in flight dropped, the extra ones are freed */
+		static constexpr int32 MaxFreeBuffers = 4;
+
+		FCriticalSection FreeBuffersCS;
+
+		TArray<TUniquePtr<FRiveRenderCommandStream>, TInlineAllocator<MaxFreeBuffers>> FreeBuffers;
+	};
+}
+
+#endif // WITH_RIVE
@@ -0,0 +1,140 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRenderCommandStream.h"
+
+#if WITH_RIVE
+
+#include "RiveDrawSnapshot.h"
+
+#include "RiveCore/Public/PreRiveHeaders.h"
+THIRD_PARTY_INCLUDES_START
+#include "rive/renderer.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace UE::Rive::Renderer::Private
+{
+	static constexpr int32 RiveTransformWords = 6;
+
+	static_assert(sizeof(float) == sizeof(uint32), "The transforms are stored as 32-bit words");
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandStream::Transform(const rive::Mat2D& InTransform)
+{
+	AddOp(ERiveRenderStreamOp::Transform);
+	const int32 Offset = Words.AddUninitialized(RiveTransformWords);
+	FMemory::Memcpy(&Words[Offset], InTransform.values(), RiveTransformWords * sizeof(uint32));
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandStream::DrawSnapshot(const TSharedRef<const FRiveDrawSnapshot>& InSnapshot)
+{
+	AddOp(ERiveRenderStreamOp::DrawSnapshot);
+	Words.Add(static_cast<uint32>(Snapshots.Add(InSnapshot)));
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandStream::DrawPath(rive::rcp<rive::RenderPath> InPath, rive::rcp<rive::RenderPaint> InPaint)
+{
+	AddOp(ERiveRenderStreamOp::DrawPath);
+	Words.Add(static_cast<uint32>(Paths.Add(std::move(InPath))));
+	Words.Add(static_cast<uint32>(Paints.Add(std::move(InPaint))));
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandStream::ClipPath(rive::rcp<rive::RenderPath> InPath)
+{
+	AddOp(ERiveRenderStreamOp::ClipPath);
+	Words.Add(static_cast<uint32>(Paths.Add(std::move(InPath))));
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandStream::Append(const FRiveRenderCommandStream& InOther)
+{
+	const uint32 SnapshotOffset = Snapshots.Num();
+	const uint32 PathOffset = Paths.Num();
+	const uint32 PaintOffset = Paints.Num();
+	const int32 WordOffset = Words.Num();
+	Words.Append(InOther.Words);
+	Snapshots.Append(InOther.Snapshots);
+	Paths.Append(InOther.Paths);
+	Paints.Append(InOther.Paints);
+	NumCommands += InOther.NumCommands;
+
+	if (SnapshotOffset == 0 && PathOffset == 0 && PaintOffset == 0)
+	{
+		return;
+	}
+
+	for (int32 WordIndex = WordOffset; WordIndex < Words.Num(); ++WordIndex)
+	{
+		switch (static_cast<ERiveRenderStreamOp>(Words[WordIndex]))
+		{
+		case ERiveRenderStreamOp::Transform:
+			WordIndex += RiveTransformWords;
+			break;
+		case ERiveRenderStreamOp::DrawSnapshot:
+			Words[++WordIndex] += SnapshotOffset;
+			break;
+		case ERiveRenderStreamOp::DrawPath:
+			Words[++WordIndex] += PathOffset;
+			Words[++WordIndex] += PaintOffset;
+			break;
+		case ERiveRenderStreamOp::ClipPath:
+			Words[++WordIndex] += PathOffset;
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandStream::Reset()
+{
+	Words.Reset();
+	Snapshots.Reset();
+	Paths.Reset();
+	Paints.Reset();
+	NumCommands = 0;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandStream::Execute(rive::Renderer* InRenderer) const
+{
+	for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+	{
+		switch (static_cast<ERiveRenderStreamOp>(Words[WordIndex]))
+		{
+		case ERiveRenderStreamOp::Save:
+			InRenderer->save();
+			break;
+		case ERiveRenderStreamOp::Restore:
+			InRenderer->restore();
+			break;
+		case ERiveRenderStreamOp::Transform:
+			{
+				float Values[RiveTransformWords];
+				FMemory::Memcpy(Values, &Words[WordIndex + 1], sizeof(Values));
+				InRenderer->transform(rive::Mat2D(Values[0], Values[1], Values[2], Values[3], Values[4], Values[5]));
+				WordIndex += RiveTransformWords;
+			}
+			break;
+		case ERiveRenderStreamOp::DrawSnapshot:
+			Snapshots[Words[++WordIndex]]->Draw(InRenderer);
+			break;
+		case ERiveRenderStreamOp::DrawPath:
+			{
+				rive::RenderPath* Path = Paths[Words[WordIndex + 1]].get();
+				rive::RenderPaint* Paint = Paints[Words[WordIndex + 2]].get();
+				InRenderer->drawPath(Path, Paint);
+				WordIndex += 2;
+			}
+			break;
+		case ERiveRenderStreamOp::ClipPath:
+			InRenderer->clipPath(Paths[Words[++WordIndex]].get());
+			break;
+		}
+	}
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderCommandStream::AddOp(ERiveRenderStreamOp InOp)
+{
+	Words.Add(static_cast<uint32>(InOp));
+	++NumCommands;
+}
+
+#endif // WITH_RIVE
@@ -0,0 +1,100 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_RIVE
+
+#include "RiveCore/Public/PreRiveHeaders.h"
+THIRD_PARTY_INCLUDES_START
+#include "rive/math/mat2d.hpp"
+#include "rive/refcnt.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace rive
+{
+	class Renderer;
+	class RenderPaint;
+	class RenderPath;
+}
+
+namespace UE::Rive::Renderer::Private
+{
+	class FRiveDrawSnapshot;
+
+	enum class ERiveRenderStreamOp : uint32
+	{
+		Save,
+		Restore,
+		/** Followed by the 6 floats of a rive::Mat2D, alignments are resolved to their matrix when recorded */
+		Transform,
+		/** Followed by the index of the snapshot in Snapshots */
+		DrawSnapshot,
+		/** Followed by the indices of the path in Paths and of the paint in Paints */
+		DrawPath,
+		/** Followed by the index of the path in Paths */
+		ClipPath
+	};
+
+	/**
+	 * Commands recorded by a render target on the Game Thread, packed as variable-size records of 32-bit words: an op and only the payload it needs.
+	 * Snapshots, paths and paints are the only non-POD data, they are kept on the side and referenced by index.
+	 */
+	class FRiveRenderCommandStream
+	{
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		void Save() { AddOp(ERiveRenderStreamOp::Save); }
+
+		void Restore() { AddOp(ERiveRenderStreamOp::Restore); }
+
+		void Transform(const rive::Mat2D& InTransform);
+
+		void DrawSnapshot(const TSharedRef<const FRiveDrawSnapshot>& InSnapshot);
+
+		/** The path and paint must be immutable, see FRiveRenderFactory::FreezePath and FreezePaint */
+		void DrawPath(rive::rcp<rive::RenderPath> InPath, rive::rcp<rive::RenderPaint> InPaint);
+
+		void ClipPath(rive::rcp<rive::RenderPath> InPath);
+
+		/** Appends the commands of another stream, its indices are rebased on this one */
+		void Append(const FRiveRenderCommandStream& InOther);
+
+		/** Empties the stream, keeping the memory for the next recording */
+		void Reset();
+
+		bool IsEmpty() const { return NumCommands == 0; }
+
+		int32 Num() const { return NumCommands; }
+
+		/** Replays the commands on the given renderer */
+		void Execute(rive::Renderer* InRenderer) const;
+
+	private:
+
+		void AddOp(ERiveRenderStreamOp InOp);
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		TArray<uint32> Words;
+
+		TArray<TSharedPtr<const FRiveDrawSnapshot>> Snapshots;
+
+		TArray<rive::rcp<rive::RenderPath>> Paths;
+
+		TArray<rive::rcp<rive::RenderPaint>> Paints;
+
+		int32 NumCommands = 0;
+	};
+}
+
+#endif // WITH_RIVE
@@ -0,0 +1,420 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRenderFactory.h"
+
+#include "RiveRenderer.h"
+#include "Hash/CityHash.h"
+
+#if WITH_RIVE
+
+#include "RiveCore/Public/PreRiveHeaders.h"
+THIRD_PARTY_INCLUDES_START
+#include "rive/pls/pls_image.hpp"
+#include "rive/pls/pls_render_context.hpp"
+THIRD_PARTY_INCLUDES_END
+
+UE::Rive::Renderer::Private::FRiveRenderPath::FRiveRenderPath(rive::RawPath& InRawPath, rive::FillRule InFillRule)
+	: FillRule(InFillRule)
+{
+	RawPath.swap(InRawPath);
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPath::rewind()
+{
+	RawPath.rewind();
+	bIsDirty = true;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPath::fillRule(rive::FillRule InFillRule)
+{
+	if (FillRule != InFillRule)
+	{
+		FillRule = InFillRule;
+		bIsDirty = true;
+	}
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPath::addRenderPath(rive::RenderPath* InPath, const rive::Mat2D& InTransform)
+{
+	LITE_RTTI_CAST_OR_RETURN(OtherPath, FRiveRenderPath*, InPath);
+	RawPath.addPath(OtherPath->RawPath, &InTransform);
+	bIsDirty = true;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPath::moveTo(float InX, float InY)
+{
+	RawPath.moveTo(InX, InY);
+	bIsDirty = true;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPath::lineTo(float InX, float InY)
+{
+	RawPath.lineTo(InX, InY);
+	bIsDirty = true;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPath::cubicTo(float InOX, float InOY, float InIX, float InIY, float InX, float InY)
+{
+	RawPath.cubicTo(InOX, InOY, InIX, InIY, InX, InY);
+	bIsDirty = true;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPath::close()
+{
+	RawPath.close();
+	bIsDirty = true;
+}
+
+rive::rcp<rive::RenderPath> UE::Rive::Renderer::Private::FRiveRenderPath::Freeze(rive::pls::PLSFactory& InPLSFactory)
+{
+	if (FrozenPath && bIsDirty && FillRule == FrozenFillRule && RawPath == FrozenRawPath)
+	{
+		bIsDirty = false;
+	}
+
+	if (!FrozenPath || bIsDirty)
+	{
+		FrozenRawPath = RawPath;
+		FrozenFillRule = FillRule;
+		bIsDirty = false;
+
+		// The PLS Path takes the arrays of the given RawPath, so it gets a copy and keeps RawPath editable
+		rive::RawPath RawPathCopy = RawPath;
+		FrozenPath = InPLSFactory.rive::pls::PLSFactory::makeRenderPath(RawPathCopy, FillRule);
+	}
+
+	return FrozenPath;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPaint::style(rive::RenderPaintStyle InStyle)
+{
+	Style = InStyle;
+	FrozenPaint = nullptr;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPaint::color(rive::ColorInt InColor)
+{
+	Color = InColor;
+	FrozenPaint = nullptr;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPaint::thickness(float InThickness)
+{
+	Thickness = InThickness;
+	FrozenPaint = nullptr;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPaint::join(rive::StrokeJoin InJoin)
+{
+	Join = InJoin;
+	FrozenPaint = nullptr;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPaint::cap(rive::StrokeCap InCap)
+{
+	Cap = InCap;
+	FrozenPaint = nullptr;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPaint::blendMode(rive::BlendMode InBlendMode)
+{
+	BlendMode = InBlendMode;
+	FrozenPaint = nullptr;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPaint::shader(rive::rcp<rive::RenderShader> InShader)
+{
+	Shader = std::move(InShader);
+	FrozenPaint = nullptr;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderPaint::invalidateStroke()
+{
+	FrozenPaint = nullptr;
+}
+
+rive::rcp<rive::RenderPaint> UE::Rive::Renderer::Private::FRiveRenderPaint::Freeze(rive::pls::PLSFactory& InPLSFactory)
+{
+	if (!FrozenPaint)
+	{
+		FrozenPaint = InPLSFactory.rive::pls::PLSFactory::makeRenderPaint();
+		FrozenPaint->style(Style);
+		FrozenPaint->color(Color);
+		FrozenPaint->thickness(Thickness);
+		FrozenPaint->join(Join);
+		FrozenPaint->cap(Cap);
+		FrozenPaint->blendMode(BlendMode);
+		FrozenPaint->shader(Shader);
+	}
+
+	return FrozenPaint;
+}
+
+UE::Rive::Renderer::Private::FRiveFrozenRenderBuffer::FRiveFrozenRenderBuffer(FRiveRenderer* InRiveRenderer, rive::RenderBufferType InType, TArray<uint8>&& InBytes)
+	: RiveRenderer(InRiveRenderer)
+	, Type(InType)
+	, Bytes(MoveTemp(InBytes))
+{
+}
+
+UE::Rive::Renderer::Private::FRiveFrozenRenderBuffer::FRiveFrozenRenderBuffer(rive::rcp<rive::RenderBuffer> InPLSBuffer)
+	: PLSBuffer(std::move(InPLSBuffer))
+{
+}
+
+UE::Rive::Renderer::Private::FRiveFrozenRenderBuffer::~FRiveFrozenRenderBuffer()
+{
+	// The last snapshot or the Game Thread may drop the buffer, its GL objects can only be deleted on the GL thread
+	if (RiveRenderer)
+	{
+		RiveRenderer->ReleasePLSResource(std::move(PLSBuffer));
+	}
+}
+
+rive::rcp<rive::RenderBuffer> UE::Rive::Renderer::Private::FRiveFrozenRenderBuffer::GetPLSBuffer()
+{
+	if (!PLSBuffer && RiveRenderer && !Bytes.IsEmpty())
+	{
+		// Created here rather than when freezing, so the Game Thread never needs the PLSRenderContext for a mesh, nor its graphics context
+		rive::pls::PLSRenderContext* PLSRenderContextPtr = RiveRenderer->GetPLSRenderContextPtr();
+		if (!PLSRenderContextPtr)
+		{
+			return nullptr;
+		}
+
+		PLSBuffer = PLSRenderContextPtr->makeRenderBuffer(Type, rive::RenderBufferFlags::mappedOnceAtInitialization, Bytes.Num());
+		if (PLSBuffer)
+		{
+			FMemory::Memcpy(PLSBuffer->map(), Bytes.GetData(), Bytes.Num());
+			PLSBuffer->unmap();
+			Bytes.Empty();
+		}
+	}
+
+	return PLSBuffer;
+}
+
+UE::Rive::Renderer::Private::FRiveRenderImage::FRiveRenderImage(FRiveRenderer* InRiveRenderer, std::unique_ptr<Bitmap> InDecodedBitmap)
+	: RiveRenderer(InRiveRenderer)
+	, DecodedBitmap(std::move(InDecodedBitmap))
+{
+	m_Width = DecodedBitmap->width();
+	m_Height = DecodedBitmap->height();
+}
+
+UE::Rive::Renderer::Private::FRiveRenderImage::~FRiveRenderImage()
+{
+	RiveRenderer->ReleasePLSResource(std::move(PLSImage));
+}
+
+rive::RenderImage* UE::Rive::Renderer::Private::FRiveRenderImage::GetPLSImage() const
+{
+	if (!PLSImage && DecodedBitmap)
+	{
+		PLSImage = FRiveRenderFactory::UploadImage(RiveRenderer, *DecodedBitmap);
+		DecodedBitmap.reset();
+	}
+
+	return PLSImage.get();
+}
+
+UE::Rive::Renderer::Private::FRiveRenderBuffer::FRiveRenderBuffer(FRiveRenderer* InRiveRenderer, rive::RenderBufferType InType, rive::RenderBufferFlags InFlags, size_t InSizeInBytes)
+	: lite_rtti_override(InType, InFlags, InSizeInBytes)
+	, RiveRenderer(InRiveRenderer)
+{
+	Bytes.SetNumZeroed(static_cast<int32>(InSizeInBytes));
+}
+
+void* UE::Rive::Renderer::Private::FRiveRenderBuffer::onMap()
+{
+	return Bytes.GetData();
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderBuffer::onUnmap()
+{
+	FrozenBuffer = nullptr;
+}
+
+TSharedRef<UE::Rive::Renderer::Private::FRiveFrozenRenderBuffer> UE::Rive::Renderer::Private::FRiveRenderBuffer::Freeze()
+{
+	if (!FrozenBuffer)
+	{
+		TArray<uint8> BytesCopy = Bytes;
+		FrozenBuffer = MakeShared<FRiveFrozenRenderBuffer>(RiveRenderer, type(), MoveTemp(BytesCopy));
+	}
+
+	return FrozenBuffer.ToSharedRef();
+}
+
+UE::Rive::Renderer::Private::FRiveRenderFactory::FRiveRenderFactory(FRiveRenderer* InRiveRenderer)
+	: RiveRenderer(InRiveRenderer)
+{
+}
+
+rive::rcp<rive::RenderBuffer> UE::Rive::Renderer::Private::FRiveRenderFactory::makeRenderBuffer(rive::RenderBufferType InType, rive::RenderBufferFlags InFlags, size_t InSizeInBytes)
+{
+	return rive::make_rcp<FRiveRenderBuffer>(RiveRenderer, InType, InFlags, InSizeInBytes);
+}
+
+rive::rcp<rive::RenderPath> UE::Rive::Renderer::Private::FRiveRenderFactory::makeRenderPath(rive::RawPath& InRawPath, rive::FillRule InFillRule)
+{
+	return rive::make_rcp<FRiveRenderPath>(InRawPath, InFillRule);
+}
+
+rive::rcp<rive::RenderPath> UE::Rive::Renderer::Private::FRiveRenderFactory::makeEmptyRenderPath()
+{
+	return rive::make_rcp<FRiveRenderPath>();
+}
+
+rive::rcp<rive::RenderPaint> UE::Rive::Renderer::Private::FRiveRenderFactory::makeRenderPaint()
+{
+	return rive::make_rcp<FRiveRenderPaint>();
+}
+
+template <typename T, typename DecodeFunctionType>
+rive::rcp<T> UE::Rive::Renderer::Private::FRiveRenderFactory::FindOrDecode(TMap<uint64, TDecodedAsset<T>>& InDecodedAssets, rive::Span<const uint8_t> InEncodedBytes, DecodeFunctionType&& InDecodeFunction)
+{
+	const uint64 Hash = CityHash64(reinterpret_cast<const char*>(InEncodedBytes.data()), static_cast<uint32>(InEncodedBytes.size()));
+	FSHAHash EncodedBytesHash;
+	FSHA1::HashBuffer(InEncodedBytes.data(), InEncodedBytes.size(), EncodedBytesHash.Hash);
+	{
+		FScopeLock Lock(&DecodedAssetsCS);
+		if (const TDecodedAsset<T>* DecodedAsset = InDecodedAssets.Find(Hash); DecodedAsset && DecodedAsset->EncodedBytesHash == EncodedBytesHash)
+		{
+			return DecodedAsset->Asset;
+		}
+	}
+
+	// Decoded outside of the lock, two files loading the same bytes at once may both decode them, the first result is kept
+	rive::rcp<T> Asset = InDecodeFunction(InEncodedBytes);
+	if (!Asset)
+	{
+		return nullptr;
+	}
+
+	FScopeLock Lock(&DecodedAssetsCS);
+	TDecodedAsset<T>& DecodedAsset = InDecodedAssets.FindOrAdd(Hash);
+	if (!DecodedAsset.Asset)
+	{
+		DecodedAsset.Asset = Asset;
+		DecodedAsset.EncodedBytesHash = EncodedBytesHash;
+	}
+	else if (DecodedAsset.EncodedBytesHash != EncodedBytesHash)
+	{
+		// Different bytes sharing a hash, the first ones keep the entry
+		return Asset;
+	}
+	return DecodedAsset.Asset;
+}
+
+rive::rcp<rive::RenderImage> UE::Rive::Renderer::Private::FRiveRenderFactory::decodeImage(rive::Span<const uint8_t> InEncodedBytes)
+{
+	return FindOrDecode(DecodedImages, InEncodedBytes, [this](rive::Span<const uint8_t> InBytes) -> rive::rcp<rive::RenderImage>
+	{
+		// Decoded without the lock of the renderer, so the workers importing files decode their images in parallel
+		std::unique_ptr<Bitmap> DecodedBitmap = Bitmap::decode(InBytes.data(), InBytes.size());
+		if (!DecodedBitmap || DecodedBitmap->width() == 0 || DecodedBitmap->height() == 0)
+		{
+			return nullptr;
+		}
+
+		if (DecodedBitmap->pixelFormat() != Bitmap::PixelFormat::RGBA)
+		{
+			DecodedBitmap->pixelFormat(Bitmap::PixelFormat::RGBA);
+		}
+
+		if (!RiveRenderer->CanCreatePLSResources())
+		{
+			// The texture is created when a snapshot first draws the image
+			return rive::make_rcp<FRiveRenderImage>(RiveRenderer, std::move(DecodedBitmap));
+		}
+
+		return UploadImage(RiveRenderer, *DecodedBitmap);
+	});
+}
+
+rive::rcp<rive::Font> UE::Rive::Renderer::Private::FRiveRenderFactory::decodeFont(rive::Span<const uint8_t> InEncodedBytes)
+{
+	return FindOrDecode(DecodedFonts, InEncodedBytes, [this](rive::Span<const uint8_t> InBytes)
+	{
+		return rive::pls::PLSFactory::decodeFont(InBytes);
+	});
+}
+
+rive::rcp<rive::RenderPath> UE::Rive::Renderer::Private::FRiveRenderFactory::FreezePath(rive::RenderPath* InPath)
+{
+	if (FRiveRenderPath* RenderPath = rive::lite_rtti_cast<FRiveRenderPath*>(InPath))
+	{
+		return RenderPath->Freeze(*this);
+	}
+
+	return rive::ref_rcp(InPath);
+}
+
+rive::rcp<rive::RenderPaint> UE::Rive::Renderer::Private::FRiveRenderFactory::FreezePaint(rive::RenderPaint* InPaint)
+{
+	if (FRiveRenderPaint* RenderPaint = rive::lite_rtti_cast<FRiveRenderPaint*>(InPaint))
+	{
+		return RenderPaint->Freeze(*this);
+	}
+
+	return rive::ref_rcp(InPaint);
+}
+
+TSharedPtr<UE::Rive::Renderer::Private::FRiveFrozenRenderBuffer> UE::Rive::Renderer::Private::FRiveRenderFactory::FreezeBuffer(rive::RenderBuffer* InBuffer)
+{
+	if (!InBuffer)
+	{
+		return nullptr;
+	}
+
+	if (FRiveRenderBuffer* RenderBuffer = rive::lite_rtti_cast<FRiveRenderBuffer*>(InBuffer))
+	{
+		return RenderBuffer->Freeze();
+	}
+
+	return MakeShared<FRiveFrozenRenderBuffer>(rive::ref_rcp(InBuffer));
+}
+
+rive::rcp<rive::RenderImage> UE::Rive::Renderer::Private::FRiveRenderFactory::UploadImage(FRiveRenderer* InRiveRenderer, const Bitmap& InDecodedBitmap)
+{
+	const uint32 Width = InDecodedBitmap.width();
+	const uint32 Height = InDecodedBitmap.height();
+
+	// Same mip chain as the images decoded by the PLSRenderContext
+	const uint32 MipLevelCount = FMath::FloorLog2(Width | Height) + 1;
+
+	FScopeLock Lock(&InRiveRenderer->GetThreadDataCS());
+	rive::rcp<rive::pls::PLSTexture> Texture = InRiveRenderer->MakeImageTexture(Width, Height, MipLevelCount, InDecodedBitmap.bytes());
+	if (!Texture)
+	{
+		return nullptr;
+	}
+
+	return rive::make_rcp<rive::pls::PLSImage>(std::move(Texture));
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderFactory::TrimDecodedAssets()
+{
+	FScopeLock Lock(&DecodedAssetsCS);
+
+	// Only this factory can give out new references, so an asset it holds the last reference to stays unused
+	for (auto It = DecodedImages.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Asset->debugging_refcnt() == 1)
+		{
+			// Called on the Game Thread, the texture of the image may only be deletable on the GL thread
+			RiveRenderer->ReleasePLSResource(MoveTemp(It->Value.Asset));
+			It.RemoveCurrent();
+		}
+	}
+	for (auto It = DecodedFonts.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Asset->debugging_refcnt() == 1)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+#endif // WITH_RIVE
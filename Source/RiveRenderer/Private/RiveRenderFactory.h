@@ -0,0 +1,367 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+
+#if WITH_RIVE
+
+#include "RiveCore/Public/PreRiveHeaders.h"
+THIRD_PARTY_INCLUDES_START
+#include "rive/decoders/bitmap_decoder.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/pls/pls_factory.hpp"
+#include "rive/renderer.hpp"
+#include "rive/text_engine.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace UE::Rive::Renderer::Private
+{
+	class FRiveRenderer;
+
+	/**
+	 * Render Path owned by the Artboards imported with FRiveRenderFactory. It only records the geometry built on the Game Thread,
+	 * the Render Thread draws the immutable copy returned by Freeze.
+	 */
+	class FRiveRenderPath : public rive::lite_rtti_override<rive::RenderPath, FRiveRenderPath>
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		FRiveRenderPath() = default;
+
+		FRiveRenderPath(rive::RawPath& InRawPath, rive::FillRule InFillRule);
+
+		//~ BEGIN : rive::RenderPath Interface
+
+	public:
+
+		virtual void rewind() override;
+
+		virtual void fillRule(rive::FillRule InFillRule) override;
+
+		virtual void addRenderPath(rive::RenderPath* InPath, const rive::Mat2D& InTransform) override;
+
+		virtual void moveTo(float InX, float InY) override;
+
+		virtual void lineTo(float InX, float InY) override;
+
+		virtual void cubicTo(float InOX, float InOY, float InIX, float InIY, float InX, float InY) override;
+
+		virtual void close() override;
+
+		//~ END : rive::RenderPath Interface
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		/** Returns an immutable copy of the current geometry, shared by every snapshot until the geometry actually changes */
+		rive::rcp<rive::RenderPath> Freeze(rive::pls::PLSFactory& InPLSFactory);
+
+		const rive::RawPath& GetRawPath() const { return RawPath; }
+
+		rive::FillRule GetFillRule() const { return FillRule; }
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		rive::RawPath RawPath;
+
+		rive::FillRule FillRule = rive::FillRule::nonZero;
+
+		rive::rcp<rive::RenderPath> FrozenPath;
+
+		/** Geometry of FrozenPath, Artboards rebuild most of their paths on every update, often with the same points */
+		rive::RawPath FrozenRawPath;
+
+		rive::FillRule FrozenFillRule = rive::FillRule::nonZero;
+
+		/** Set by any modification, FrozenPath is then only replaced if the geometry differs from FrozenRawPath */
+		bool bIsDirty = false;
+	};
+
+	/**
+	 * Render Paint owned by the Artboards imported with FRiveRenderFactory, see FRiveRenderPath.
+	 */
+	class FRiveRenderPaint : public rive::lite_rtti_override<rive::RenderPaint, FRiveRenderPaint>
+	{
+		//~ BEGIN : rive::RenderPaint Interface
+
+	public:
+
+		virtual void style(rive::RenderPaintStyle InStyle) override;
+
+		virtual void color(rive::ColorInt InColor) override;
+
+		virtual void thickness(float InThickness) override;
+
+		virtual void join(rive::StrokeJoin InJoin) override;
+
+		virtual void cap(rive::StrokeCap InCap) override;
+
+		virtual void blendMode(rive::BlendMode InBlendMode) override;
+
+		virtual void shader(rive::rcp<rive::RenderShader> InShader) override;
+
+		virtual void invalidateStroke() override;
+
+		//~ END : rive::RenderPaint Interface
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		/** Returns an immutable copy of the current state, shared by every snapshot until the paint gets modified again */
+		rive::rcp<rive::RenderPaint> Freeze(rive::pls::PLSFactory& InPLSFactory);
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		rive::RenderPaintStyle Style = rive::RenderPaintStyle::fill;
+
+		rive::ColorInt Color = 0xff000000;
+
+		float Thickness = 1.f;
+
+		rive::StrokeJoin Join = rive::StrokeJoin::miter;
+
+		rive::StrokeCap Cap = rive::StrokeCap::butt;
+
+		rive::BlendMode BlendMode = rive::BlendMode::srcOver;
+
+		rive::rcp<rive::RenderShader> Shader;
+
+		rive::rcp<rive::RenderPaint> FrozenPaint;
+	};
+
+	/**
+	 * Immutable content of a FRiveRenderBuffer. The PLS Buffer is only created the first time a snapshot replays it,
+	 * on the thread rendering with the PLSRenderContext, the snapshots replaying it are never executed concurrently.
+	 */
+	class FRiveFrozenRenderBuffer
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		FRiveFrozenRenderBuffer(FRiveRenderer* InRiveRenderer, rive::RenderBufferType InType, TArray<uint8>&& InBytes);
+
+		/** Wraps a buffer which was not created by FRiveRenderFactory, it is drawn as is */
+		explicit FRiveFrozenRenderBuffer(rive::rcp<rive::RenderBuffer> InPLSBuffer);
+
+		~FRiveFrozenRenderBuffer();
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		/** Must only be called while replaying a snapshot */
+		rive::rcp<rive::RenderBuffer> GetPLSBuffer();
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		FRiveRenderer* RiveRenderer = nullptr;
+
+		rive::RenderBufferType Type = rive::RenderBufferType::vertex;
+
+		TArray<uint8> Bytes;
+
+		rive::rcp<rive::RenderBuffer> PLSBuffer;
+	};
+
+	/**
+	 * Render Buffer owned by the Artboards imported with FRiveRenderFactory, see FRiveRenderPath. The Game Thread maps it into CPU memory,
+	 * image meshes deform their vertices on every update while the Render Thread replays an earlier snapshot.
+	 */
+	class FRiveRenderBuffer : public rive::lite_rtti_override<rive::RenderBuffer, FRiveRenderBuffer>
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		FRiveRenderBuffer(FRiveRenderer* InRiveRenderer, rive::RenderBufferType InType, rive::RenderBufferFlags InFlags, size_t InSizeInBytes);
+
+		//~ BEGIN : rive::RenderBuffer Interface
+
+	protected:
+
+		virtual void* onMap() override;
+
+		virtual void onUnmap() override;
+
+		//~ END : rive::RenderBuffer Interface
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		/** Returns an immutable copy of the current content, shared by every snapshot until the buffer gets mapped again */
+		TSharedRef<FRiveFrozenRenderBuffer> Freeze();
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		FRiveRenderer* RiveRenderer = nullptr;
+
+		TArray<uint8> Bytes;
+
+		TSharedPtr<FRiveFrozenRenderBuffer> FrozenBuffer;
+	};
+
+	/**
+	 * Render Image decoded by FRiveRenderFactory on a thread where the PLSRenderContext cannot create textures, e.g. a worker importing a file
+	 * while OpenGL renders on the RHI Thread. It keeps the decoded pixels until a snapshot replays it on the thread rendering with the PLSRenderContext.
+	 */
+	class FRiveRenderImage : public rive::lite_rtti_override<rive::RenderImage, FRiveRenderImage>
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		FRiveRenderImage(FRiveRenderer* InRiveRenderer, std::unique_ptr<Bitmap> InDecodedBitmap);
+
+		virtual ~FRiveRenderImage() override;
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		/** Returns the PLS Image to draw, creating its texture the first time. Must only be called while replaying a snapshot */
+		rive::RenderImage* GetPLSImage() const;
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		FRiveRenderer* RiveRenderer = nullptr;
+
+		/** RGBA pixels, released once the texture is created */
+		mutable std::unique_ptr<Bitmap> DecodedBitmap;
+
+		mutable rive::rcp<rive::RenderImage> PLSImage;
+	};
+
+	/**
+	 * Factory given to rive::File::import. Paths, Paints and Buffers are created as FRiveRenderPath, FRiveRenderPaint and FRiveRenderBuffer
+	 * so the Game Thread can snapshot them, gradients are immutable and are created as PLS ones directly.
+	 * Images are decoded on the calling thread, then uploaded with the lock of the renderer, or kept as FRiveRenderImage on the threads where the renderer cannot create PLS resources.
+	 * It can be used from any thread, the calls to the PLSRenderContext take the lock of the renderer.
+	 * Decoded images and fonts are shared by every file embedding the same bytes, until TrimDecodedAssets finds them unused.
+	 */
+	class FRiveRenderFactory : public rive::pls::PLSFactory
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		explicit FRiveRenderFactory(FRiveRenderer* InRiveRenderer);
+
+		//~ BEGIN : rive::Factory Interface
+
+	public:
+
+		virtual rive::rcp<rive::RenderBuffer> makeRenderBuffer(rive::RenderBufferType InType, rive::RenderBufferFlags InFlags, size_t InSizeInBytes) override;
+
+		virtual rive::rcp<rive::RenderPath> makeRenderPath(rive::RawPath& InRawPath, rive::FillRule InFillRule) override;
+
+		virtual rive::rcp<rive::RenderPath> makeEmptyRenderPath() override;
+
+		virtual rive::rcp<rive::RenderPaint> makeRenderPaint() override;
+
+		virtual rive::rcp<rive::RenderImage> decodeImage(rive::Span<const uint8_t> InEncodedBytes) override;
+
+		virtual rive::rcp<rive::Font> decodeFont(rive::Span<const uint8_t> InEncodedBytes) override;
+
+		//~ END : rive::Factory Interface
+
+		/**
+		 * Implementation(s)
+		 */
+
+	public:
+
+		/** Returns the immutable PLS Path to draw for the given path, which is returned as is if it was not created by this factory */
+		rive::rcp<rive::RenderPath> FreezePath(rive::RenderPath* InPath);
+
+		/** Returns the immutable PLS Paint to draw for the given paint, which is returned as is if it was not created by this factory */
+		rive::rcp<rive::RenderPaint> FreezePaint(rive::RenderPaint* InPaint);
+
+		/** Returns the immutable content to draw for the given buffer, see FRiveFrozenRenderBuffer */
+		TSharedPtr<FRiveFrozenRenderBuffer> FreezeBuffer(rive::RenderBuffer* InBuffer);
+
+		/** Releases the decoded images and fonts which are only referenced by this factory anymore */
+		void TrimDecodedAssets();
+
+		/** Creates the PLS Image of the given RGBA pixels, on a thread where the renderer CanCreatePLSResources */
+		static rive::rcp<rive::RenderImage> UploadImage(FRiveRenderer* InRiveRenderer, const Bitmap& InDecodedBitmap);
+
+	private:
+
+		template <typename T>
+		struct TDecodedAsset
+		{
+			rive::rcp<T> Asset;
+
+			/** SHA-1 of the encoded bytes, confirms a match of their CityHash key before the asset is shared */
+			FSHAHash EncodedBytesHash;
+		};
+
+		template <typename T, typename DecodeFunctionType>
+		rive::rcp<T> FindOrDecode(TMap<uint64, TDecodedAsset<T>>& InDecodedAssets, rive::Span<const uint8_t> InEncodedBytes, DecodeFunctionType&& InDecodeFunction);
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		FRiveRenderer* RiveRenderer = nullptr;
+
+		/** Keyed by the hash of the encoded bytes */
+		TMap<uint64, TDecodedAsset<rive::RenderImage>> DecodedImages;
+
+		TMap<uint64, TDecodedAsset<rive::Font>> DecodedFonts;
+
+		FCriticalSection DecodedAssetsCS;
+	};
+}
+
+#endif // WITH_RIVE
@@ -6,23 +6,33 @@
 #include "Engine/Texture2DDynamic.h"
 #include "Logs/RiveRendererLog.h"
 #include "RenderingThread.h"
+#include "RiveDrawSnapshot.h"
+#include "RiveRenderFactory.h"
+#include "RiveRenderTargetAtlasEntry.h"
+#include "RiveScopeLock.h"
+#include "RiveTypes.h"
+#include "Stats/RiveRendererStats.h"
 #include "TextureResource.h"
 
+#if PLATFORM_APPLE
+#include "Mac/AutoreleasePool.h"
+#endif // PLATFORM_APPLE
+
 #include "RiveCore/Public/PreRiveHeaders.h"
 THIRD_PARTY_INCLUDES_START
 #include "rive/artboard.hpp"
 #include "rive/pls/pls_renderer.hpp"
+#include "rive/renderer.hpp"
 THIRD_PARTY_INCLUDES_END
 
-#if PLATFORM_APPLE
-#include "Mac/AutoreleasePool.h"
-#endif
-
 FTimespan UE::Rive::Renderer::Private::FRiveRenderTarget::ResetTimeLimit = FTimespan(0, 0, 20);
 
 UE::Rive::Renderer::Private::FRiveRenderTarget::FRiveRenderTarget(const TSharedRef<FRiveRenderer>& InRiveRenderer, const FName& InRiveName, UTexture2DDynamic* InRenderTarget)
 	: RiveName(InRiveName)
 	, RenderTarget(InRenderTarget)
+#if WITH_RIVE
+	, CommandBufferPool(MakeShared<FRiveRenderCommandBufferPool, ESPMode::ThreadSafe>())
+#endif // WITH_RIVE
 	, RiveRenderer(InRiveRenderer)
 {
 	RIVE_DEBUG_FUNCTION_INDENT;
@@ -37,7 +47,6 @@ void UE::Rive::Renderer::Private::FRiveRenderTarget::Initialize()
 {
 	check(IsInGameThread());
 
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
 	FTextureResource* RenderTargetResource = RenderTarget->GetResource();
 	ENQUEUE_RENDER_COMMAND(CacheTextureTarget_RenderThread)(
 		[RenderTargetResource, this](FRHICommandListImmediate& RHICmdList)
@@ -50,75 +59,133 @@ void UE::Rive::Renderer::Private::FRiveRenderTarget::Submit()
 {
 	check(IsInGameThread());
 
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+	// The commands are kept for the next submission, so they are copied into a pooled buffer which already has the capacity for them
+	FRiveRenderCommandBuffer CommandBuffer = CommandBufferPool->Acquire();
+	CommandBuffer->Append(RenderCommands);
+	MarkSubmitted();
+	SubmitCommandBuffer(MoveTemp(CommandBuffer));
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderTarget::SubmitAndClear()
+{
+	check(IsInGameThread());
+
+	// The recorded array itself is submitted, and the next commands are recorded in the empty pooled one
+	FRiveRenderCommandBuffer CommandBuffer = CommandBufferPool->Acquire();
+	Swap(*CommandBuffer, RenderCommands);
+	ClearRenderCommands();
+	MarkSubmitted();
+	SubmitCommandBuffer(MoveTemp(CommandBuffer));
+}
 
-	// Making a copy of the RenderCommands to be processed on RenderingThread
-	ENQUEUE_RENDER_COMMAND(Render)(
-		[this, RiveRenderCommands = RenderCommands](FRHICommandListImmediate& RHICmdList)
+void UE::Rive::Renderer::Private::FRiveRenderTarget::SubmitCommandBuffer(FRiveRenderCommandBuffer&& InCommandBuffer)
+{
+	RiveRenderer->EnqueueRenderWork_GameThread(
+		[this, CommandBuffer = MoveTemp(InCommandBuffer)](FRHICommandListImmediate& RHICmdList) mutable
 		{
-			Render_RenderThread(RHICmdList, RiveRenderCommands);
+			Render_RenderThread(RHICmdList, MoveTemp(CommandBuffer));
 		});
 }
 
-void UE::Rive::Renderer::Private::FRiveRenderTarget::SubmitAndClear()
+void UE::Rive::Renderer::Private::FRiveRenderTarget::MarkSubmitted()
+{
+	bHasSubmitted = true;
+	LastSubmittedSize = FIntPoint(GetWidth(), GetHeight());
+	LastSubmittedClearColor = ClearColor;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderTarget::ClearRenderCommands()
+{
+	RenderCommands.Reset();
+	CurrentTransform = rive::Mat2D();
+	SavedTransforms.Reset();
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderTarget::PushTransform(const rive::Mat2D& InTransform)
 {
-	Submit();
-	RenderCommands.Empty();
+	RenderCommands.Transform(InTransform);
+	CurrentTransform = CurrentTransform * InTransform;
 }
 
 void UE::Rive::Renderer::Private::FRiveRenderTarget::Save()
 {
-	const FRiveRenderCommand RenderCommand(ERiveRenderCommandType::Save);
-	RenderCommands.Push(RenderCommand);
+	RenderCommands.Save();
+	SavedTransforms.Push(CurrentTransform);
 }
 
 void UE::Rive::Renderer::Private::FRiveRenderTarget::Restore()
 {
-	const FRiveRenderCommand RenderCommand(ERiveRenderCommandType::Restore);
-	RenderCommands.Push(RenderCommand);
+	RenderCommands.Restore();
+	CurrentTransform = SavedTransforms.IsEmpty() ? rive::Mat2D() : SavedTransforms.Pop();
 }
 
 void UE::Rive::Renderer::Private::FRiveRenderTarget::Transform(float X1, float Y1, float X2, float Y2, float TX, float TY)
 {
-	FRiveRenderCommand RenderCommand(ERiveRenderCommandType::Transform);
-	RenderCommand.X = X1;
-	RenderCommand.Y = Y1;
-	RenderCommand.X2 = X2;
-	RenderCommand.Y2 = Y2;
-	RenderCommand.TX = TX;
-	RenderCommand.TY = TY;
-	RenderCommands.Push(RenderCommand);
+	PushTransform(rive::Mat2D(X1, Y1, X2, Y2, TX, TY));
 }
 
 void UE::Rive::Renderer::Private::FRiveRenderTarget::Translate(const FVector2f& InVector)
 {
-	FRiveRenderCommand RenderCommand(ERiveRenderCommandType::Translate);
-	RenderCommand.TX = InVector.X;
-	RenderCommand.TY = InVector.Y;
-	RenderCommands.Push(RenderCommand);
+	PushTransform(rive::Mat2D::fromTranslate(InVector.X, InVector.Y));
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderTarget::Draw(rive::Artboard* InArtboard, FCriticalSection* InArtboardCS)
+{
+	check(IsInGameThread());
+
+	FRiveRenderFactory* RenderFactory = RiveRenderer->GetRenderFactory();
+	if (!InArtboard || !RenderFactory)
+	{
+		return;
+	}
+
+	TSharedPtr<const FRiveDrawSnapshot> DrawSnapshot;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_RiveRendererRecordSnapshot);
+		FRiveScopeLock ArtboardLock(InArtboardCS, GET_STATID(STAT_RiveRendererArtboardLockWait));
+		FRiveDrawSnapshotRecorder Recorder(*RenderFactory, DrawSnapshotPool.Acquire(), LastDrawSnapshotNum);
+		InArtboard->draw(&Recorder);
+		DrawSnapshot = Recorder.Finish();
+	}
+	LastDrawSnapshotNum = DrawSnapshot->Num();
+	RenderCommands.DrawSnapshot(DrawSnapshot.ToSharedRef());
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderTarget::DrawPath(rive::RenderPath* InPath, rive::RenderPaint* InPaint)
+{
+	check(IsInGameThread());
+
+	FRiveRenderFactory* RenderFactory = RiveRenderer->GetRenderFactory();
+	if (!InPath || !InPaint || !RenderFactory)
+	{
+		return;
+	}
+
+	RenderCommands.DrawPath(RenderFactory->FreezePath(InPath), RenderFactory->FreezePaint(InPaint));
 }
 
-void UE::Rive::Renderer::Private::FRiveRenderTarget::Draw(rive::Artboard* InArtboard)
+void UE::Rive::Renderer::Private::FRiveRenderTarget::ClipPath(rive::RenderPath* InPath)
 {
-	FRiveRenderCommand RenderCommand(ERiveRenderCommandType::DrawArtboard);
-	RenderCommand.NativeArtboard = InArtboard;
-	RenderCommands.Push(RenderCommand);
+	check(IsInGameThread());
+
+	FRiveRenderFactory* RenderFactory = RiveRenderer->GetRenderFactory();
+	if (!InPath || !RenderFactory)
+	{
+		return;
+	}
+
+	RenderCommands.ClipPath(RenderFactory->FreezePath(InPath));
 }
 
 void UE::Rive::Renderer::Private::FRiveRenderTarget::Align(const FBox2f& InBox, ERiveFitType InFit, const FVector2f& InAlignment, rive::Artboard* InArtboard)
 {
-	FRiveRenderCommand RenderCommand(ERiveRenderCommandType::AlignArtboard);
-	RenderCommand.FitType = InFit;
-	RenderCommand.X = InAlignment.X;
-	RenderCommand.Y = InAlignment.Y;
-
-	RenderCommand.TX = InBox.Min.X;
-	RenderCommand.TY = InBox.Min.Y;
-	RenderCommand.X2 = InBox.Max.X;
-	RenderCommand.Y2 = InBox.Max.Y;
-	
-	RenderCommand.NativeArtboard = InArtboard;
-	RenderCommands.Push(RenderCommand);
+	// Resolved to a matrix with the bounds the Artboard has now, the Render Thread only applies it
+	const rive::AABB ArtboardBounds = InArtboard ? InArtboard->bounds() : rive::AABB();
+	PushTransform(rive::computeAlignment(
+		static_cast<rive::Fit>(InFit),
+		rive::Alignment(InAlignment.X, InAlignment.Y),
+		rive::AABB(InBox.Min.X, InBox.Min.Y, InBox.Max.X, InBox.Max.Y),
+		ArtboardBounds));
 }
 
 void UE::Rive::Renderer::Private::FRiveRenderTarget::Align(ERiveFitType InFit, const FVector2f& InAlignment, rive::Artboard* InArtboard)
@@ -128,29 +195,44 @@ void UE::Rive::Renderer::Private::FRiveRenderTarget::Align(ERiveFitType InFit, c
 
 FMatrix UE::Rive::Renderer::Private::FRiveRenderTarget::GetTransformMatrix() const
 {
-	TArray<FMatrix> SavedMatrices;
-	FMatrix CurrentMatrix = FMatrix::Identity;
-	
-	for (const FRiveRenderCommand& RenderCommand : RenderCommands)
+	return FMatrix(
+		FVector{CurrentTransform.xx(), CurrentTransform.xy(), 0},
+		FVector{CurrentTransform.yx(), CurrentTransform.yy(), 0},
+		FVector{0, 0, 1},
+		FVector{CurrentTransform.tx(), CurrentTransform.ty(), 0});
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderTarget::DrawAtlasEntry(const IRiveRenderTargetRef& InEntryTarget, const FIntPoint& InOffset)
+{
+	check(IsInGameThread());
+
+	FRiveRenderTarget& Target = static_cast<FRiveRenderTarget&>(InEntryTarget.Get());
+	const FRiveRenderCommandStream* EntryCommands = Target.GetAtlasEntryCommands();
+	FRiveRenderFactory* RenderFactory = RiveRenderer->GetRenderFactory();
+	if (!EntryCommands || !RenderFactory)
 	{
-		switch (RenderCommand.Type)
-		{
-		case ERiveRenderCommandType::Save:
-			SavedMatrices.Add(CurrentMatrix);
-			break;
-		case ERiveRenderCommandType::Restore:
-			CurrentMatrix = SavedMatrices.IsEmpty() ? FMatrix::Identity : SavedMatrices.Pop();
-			break;
-		case ERiveRenderCommandType::AlignArtboard:
-		case ERiveRenderCommandType::Transform:
-		case ERiveRenderCommandType::Translate:
-			CurrentMatrix = RenderCommand.GetSavedTransform() * CurrentMatrix;
-			break;
-		default:
-			break;
-		}
+		UE_LOG(LogRiveRenderer, Error, TEXT("Unable to draw '%s' in the atlas page '%s', it is not an atlas entry target."), *Target.RiveName.ToString(), *RiveName.ToString());
+		return;
+	}
+
+	// Only the atlas entry targets have commands to replay
+	FRiveRenderTargetAtlasEntry& EntryTarget = static_cast<FRiveRenderTargetAtlasEntry&>(Target);
+
+	// The page is cleared as a whole, so each entry fills its own rect with its clear color and is clipped to it
+	rive::RenderPath* EntryPath = EntryTarget.GetEntryPath(*RenderFactory);
+
+	Save();
+	Translate(FVector2f(InOffset));
+
+	ClipPath(EntryPath);
+
+	if (rive::RenderPaint* ClearPaint = EntryTarget.GetClearPaint(*RenderFactory))
+	{
+		DrawPath(EntryPath, ClearPaint);
 	}
-	return CurrentMatrix;
+
+	RenderCommands.Append(*EntryCommands);
+	Restore();
 }
 
 std::unique_ptr<rive::pls::PLSRenderer> UE::Rive::Renderer::Private::FRiveRenderTarget::BeginFrame()
@@ -161,7 +243,7 @@ std::unique_ptr<rive::pls::PLSRenderer> UE::Rive::Renderer::Private::FRiveRender
 		return nullptr;
 	}
 
-	FColor Color = ClearColor.ToRGBE();
+	const FColor Color = ClearColor.ToFColor(true);
 	rive::pls::PLSRenderContext::FrameDescriptor FrameDescriptor;
 	FrameDescriptor.renderTargetWidth = GetWidth();
 	FrameDescriptor.renderTargetHeight = GetHeight();
@@ -204,6 +286,11 @@ void UE::Rive::Renderer::Private::FRiveRenderTarget::EndFrame() const
 	PLSRenderContextPtr->flush(FlushResources);
 }
 
+bool UE::Rive::Renderer::Private::FRiveRenderTarget::NeedsRedraw() const
+{
+	return !bHasSubmitted || LastSubmittedSize != FIntPoint(GetWidth(), GetHeight()) || LastSubmittedClearColor != ClearColor;
+}
+
 uint32 UE::Rive::Renderer::Private::FRiveRenderTarget::GetWidth() const
 {
 	return RenderTarget->SizeX;
@@ -215,17 +302,18 @@ uint32 UE::Rive::Renderer::Private::FRiveRenderTarget::GetHeight() const
 }
 
 DECLARE_GPU_STAT_NAMED(Render, TEXT("RiveRenderTarget::Render"));
-void UE::Rive::Renderer::Private::FRiveRenderTarget::Render_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FRiveRenderCommand>& RiveRenderCommands)
+void UE::Rive::Renderer::Private::FRiveRenderTarget::Render_RenderThread(FRHICommandListImmediate& RHICmdList, FRiveRenderCommandBuffer&& InCommandBuffer)
 {
 	SCOPED_GPU_STAT(RHICmdList, Render);
 	check(IsInRenderingThread());
 	
-	Render_Internal(RiveRenderCommands);
+	Render_Internal(*InCommandBuffer);
 }
 
-void UE::Rive::Renderer::Private::FRiveRenderTarget::Render_Internal(const TArray<FRiveRenderCommand>& RiveRenderCommands)
+void UE::Rive::Renderer::Private::FRiveRenderTarget::Render_Internal(const FRiveRenderCommandStream& RiveRenderCommands)
 {
-	FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+	// Guards the PLSRenderContext for the whole frame, the Artboards are not locked as only their recorded snapshots are drawn
+	FRiveScopeLock Lock(&RiveRenderer->GetThreadDataCS(), GET_STATID(STAT_RiveRendererLockWait));
 
 	// Sometimes Render commands can be empty (perhaps an issue with Lock contention)
 	// Checking for empty here will prevent rendered "blank" frames
@@ -233,11 +321,16 @@ void UE::Rive::Renderer::Private::FRiveRenderTarget::Render_Internal(const TArra
 	{
 		return;
 	}
-    
+
 #if PLATFORM_APPLE
-    AutoreleasePool Pool;
-#endif
-    
+	// Covers the objects autoreleased by the whole frame, within a render batch FRiveRendererMetal holds a single pool around all the targets
+	TOptional<AutoreleasePool> Pool;
+	if (!RiveRenderer->IsInRenderBatch_RenderThread())
+	{
+		Pool.Emplace();
+	}
+#endif // PLATFORM_APPLE
+
 	// Begin Frame
 	std::unique_ptr<rive::pls::PLSRenderer> PLSRenderer = BeginFrame();
 	if (PLSRenderer == nullptr)
@@ -251,35 +344,7 @@ void UE::Rive::Renderer::Private::FRiveRenderTarget::Render_Internal(const TArra
 #endif
 	
 	RIVE_DEBUG_VERBOSE("Executing queue with %d items for '%s'", RiveRenderCommands.Num(), *RiveName.ToString());
-	for (const FRiveRenderCommand& RenderCommand : RiveRenderCommands)
-	{
-		switch (RenderCommand.Type)
-		{
-		case ERiveRenderCommandType::Save:
-			PLSRenderer->save();
-			break;
-		case ERiveRenderCommandType::Restore:
-			PLSRenderer->restore();
-			break;
-		case ERiveRenderCommandType::DrawArtboard:
-#if PLATFORM_ANDROID
-			RIVE_DEBUG_VERBOSE("RenderCommand.NativeArtboard->draw()");
-#endif
-			RenderCommand.NativeArtboard->draw(PLSRenderer.get());
-			break;
-		case ERiveRenderCommandType::DrawPath:
-			// TODO: Support DrawPath
-			break;
-		case ERiveRenderCommandType::ClipPath:
-			// TODO: Support ClipPath
-			break;
-		case ERiveRenderCommandType::Transform:
-		case ERiveRenderCommandType::AlignArtboard:
-		case ERiveRenderCommandType::Translate:
-			PLSRenderer->transform(RenderCommand.GetSaved2DTransform());
-			break;
-		}
-	}
+	RiveRenderCommands.Execute(PLSRenderer.get());
 
 	EndFrame();
 }
@@ -5,11 +5,13 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectPtr.h"
 #include "IRiveRenderTarget.h"
-#include "RiveRenderCommand.h"
+#include "RiveRenderCommandBuffer.h"
+#include "RiveDrawSnapshot.h"
 
 #if WITH_RIVE
 #include "RiveCore/Public/PreRiveHeaders.h"
 THIRD_PARTY_INCLUDES_START
+#include "rive/math/mat2d.hpp"
 #include "rive/refcnt.hpp"
 THIRD_PARTY_INCLUDES_END
 
@@ -41,6 +43,7 @@ namespace UE::Rive::Renderer::Private
 		virtual uint32 GetWidth() const override;
 		virtual uint32 GetHeight() const override;
 		virtual void SetClearColor(const FLinearColor& InColor) override { ClearColor = InColor; }
+		virtual bool NeedsRedraw() const override;
 	
 		//~ END : IRiveRenderTarget Interface
 
@@ -55,17 +58,30 @@ namespace UE::Rive::Renderer::Private
 		virtual void Restore() override;
 		virtual void Transform(float X1, float Y1, float X2, float Y2, float TX, float TY) override;
 		virtual void Translate(const FVector2f& InVector) override;
-		virtual void Draw(rive::Artboard* InArtboard) override;
+		virtual void Draw(rive::Artboard* InArtboard, FCriticalSection* InArtboardCS) override;
+		virtual void DrawPath(rive::RenderPath* InPath, rive::RenderPaint* InPaint) override;
+		virtual void ClipPath(rive::RenderPath* InPath) override;
 		virtual void Align(const FBox2f& InBox, ERiveFitType InFit, const FVector2f& InAlignment, rive::Artboard* InArtboard) override;
 		virtual void Align(ERiveFitType InFit, const FVector2f& InAlignment, rive::Artboard* InArtboard) override;
 		virtual FMatrix GetTransformMatrix() const override;
+		virtual void DrawAtlasEntry(const IRiveRenderTargetRef& InEntryTarget, const FIntPoint& InOffset) override;
+
+		/** Returns the commands of the last submission of an atlas entry target, nullptr for the targets rendering to their own texture */
+		virtual const FRiveRenderCommandStream* GetAtlasEntryCommands() const { return nullptr; }
 
 	protected:
 		virtual rive::rcp<rive::pls::PLSRenderTarget> GetRenderTarget() const = 0;
 		virtual std::unique_ptr<rive::pls::PLSRenderer> BeginFrame();
 		virtual void EndFrame() const;
-		virtual void Render_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FRiveRenderCommand>& RiveRenderCommands);
-		virtual void Render_Internal(const TArray<FRiveRenderCommand>& RiveRenderCommands);
+		/** Hands the buffer over to the Render Thread, it goes back to the pool once Render_RenderThread is done with it */
+		virtual void SubmitCommandBuffer(FRiveRenderCommandBuffer&& InCommandBuffer);
+		void MarkSubmitted();
+		/** Empties RenderCommands along with the transform stack recorded from them */
+		void ClearRenderCommands();
+		/** Records the transform and applies it to CurrentTransform */
+		void PushTransform(const rive::Mat2D& InTransform);
+		virtual void Render_RenderThread(FRHICommandListImmediate& RHICmdList, FRiveRenderCommandBuffer&& InCommandBuffer);
+		virtual void Render_Internal(const FRiveRenderCommandStream& RiveRenderCommands);
 #endif // WITH_RIVE
 	
 	protected:
@@ -73,8 +89,24 @@ namespace UE::Rive::Renderer::Private
 		FLinearColor ClearColor = FLinearColor::Transparent;
 		FName RiveName;
 		TObjectPtr<UTexture2DDynamic> RenderTarget;
-		TArray<FRiveRenderCommand> RenderCommands;
+#if WITH_RIVE
+		FRiveRenderCommandStream RenderCommands;
+		/** Buffers the submitted commands are handed to the Render Thread in */
+		TSharedRef<FRiveRenderCommandBufferPool, ESPMode::ThreadSafe> CommandBufferPool;
+		/** Snapshots the Artboards are recorded into, recycled once the Render Thread released them */
+		FRiveDrawSnapshotPool DrawSnapshotPool;
+		/** Transform in effect at the end of RenderCommands, updated as the commands are recorded so GetTransformMatrix does not replay them */
+		rive::Mat2D CurrentTransform;
+		/** Transforms pushed by the recorded Save commands not restored yet */
+		TArray<rive::Mat2D> SavedTransforms;
+#endif // WITH_RIVE
 		TSharedPtr<FRiveRenderer> RiveRenderer;
+		/** Number of commands of the last recorded snapshot, used to presize the next one */
+		int32 LastDrawSnapshotNum = 0;
+		/** State of the last submission, the content of the texture only needs to be redrawn when they change */
+		bool bHasSubmitted = false;
+		FIntPoint LastSubmittedSize = FIntPoint::ZeroValue;
+		FLinearColor LastSubmittedClearColor = FLinearColor::Transparent;
 		mutable FDateTime LastResetTime = FDateTime::Now();
 		static FTimespan ResetTimeLimit;
 	};
@@ -0,0 +1,81 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRenderTargetAtlasEntry.h"
+
+#include "RiveRenderer.h"
+#include "RiveRenderFactory.h"
+
+#if WITH_RIVE
+#include "RiveCore/Public/PreRiveHeaders.h"
+THIRD_PARTY_INCLUDES_START
+#include "rive/math/raw_path.hpp"
+#include "rive/pls/pls_render_target.hpp"
+THIRD_PARTY_INCLUDES_END
+#endif // WITH_RIVE
+
+UE::Rive::Renderer::Private::FRiveRenderTargetAtlasEntry::FRiveRenderTargetAtlasEntry(const TSharedRef<FRiveRenderer>& InRiveRenderer, const FName& InRiveName, const FIntPoint& InSize)
+	: FRiveRenderTarget(InRiveRenderer, InRiveName, nullptr)
+	, Size(InSize)
+{
+}
+
+#if WITH_RIVE
+
+void UE::Rive::Renderer::Private::FRiveRenderTargetAtlasEntry::Submit()
+{
+	check(IsInGameThread());
+
+	MarkSubmitted();
+	SubmittedCommands.Reset();
+	SubmittedCommands.Append(RenderCommands);
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderTargetAtlasEntry::SubmitAndClear()
+{
+	check(IsInGameThread());
+
+	MarkSubmitted();
+	Swap(SubmittedCommands, RenderCommands);
+	ClearRenderCommands();
+}
+
+rive::rcp<rive::pls::PLSRenderTarget> UE::Rive::Renderer::Private::FRiveRenderTargetAtlasEntry::GetRenderTarget() const
+{
+	return nullptr;
+}
+
+rive::RenderPath* UE::Rive::Renderer::Private::FRiveRenderTargetAtlasEntry::GetEntryPath(FRiveRenderFactory& InRenderFactory)
+{
+	if (!EntryPath)
+	{
+		rive::RawPath EntryRawPath;
+		EntryRawPath.addRect(rive::AABB(0.f, 0.f, Size.X, Size.Y));
+		EntryPath = InRenderFactory.makeRenderPath(EntryRawPath, rive::FillRule::nonZero);
+	}
+
+	return EntryPath.get();
+}
+
+rive::RenderPaint* UE::Rive::Renderer::Private::FRiveRenderTargetAtlasEntry::GetClearPaint(FRiveRenderFactory& InRenderFactory)
+{
+	if (ClearColor.A <= 0.f)
+	{
+		return nullptr;
+	}
+
+	if (!ClearPaint || ClearPaintColor != ClearColor)
+	{
+		if (!ClearPaint)
+		{
+			ClearPaint = InRenderFactory.makeRenderPaint();
+		}
+
+		const FColor Color = ClearColor.ToFColor(true);
+		ClearPaint->color(rive::colorARGB(Color.A, Color.R, Color.G, Color.B));
+		ClearPaintColor = ClearColor;
+	}
+
+	return ClearPaint.get();
+}
+
+#endif // WITH_RIVE
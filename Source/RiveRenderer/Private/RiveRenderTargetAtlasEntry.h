@@ -0,0 +1,103 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "RiveRenderTarget.h"
+
+#if WITH_RIVE
+#include "RiveCore/Public/PreRiveHeaders.h"
+THIRD_PARTY_INCLUDES_START
+#include "rive/renderer.hpp"
+THIRD_PARTY_INCLUDES_END
+#endif // WITH_RIVE
+
+namespace UE::Rive::Renderer::Private
+{
+	class FRiveRenderFactory;
+
+	/**
+	 * Render Target without texture of its own, used for the sub-rects of a texture atlas page.
+	 * Its submissions are only kept, the page target replays them with FRiveRenderTarget::DrawAtlasEntry so every entry of a page is drawn in the same PLS frame.
+	 */
+	class FRiveRenderTargetAtlasEntry final : public FRiveRenderTarget
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		FRiveRenderTargetAtlasEntry(const TSharedRef<FRiveRenderer>& InRiveRenderer, const FName& InRiveName, const FIntPoint& InSize);
+
+		//~ BEGIN : IRiveRenderTarget Interface
+
+	public:
+
+		virtual void Initialize() override {}
+
+		virtual uint32 GetWidth() const override { return Size.X; }
+
+		virtual uint32 GetHeight() const override { return Size.Y; }
+
+#if WITH_RIVE
+
+		virtual void Submit() override;
+
+		virtual void SubmitAndClear() override;
+
+#endif // WITH_RIVE
+
+		//~ END : IRiveRenderTarget Interface
+
+		//~ BEGIN : FRiveRenderTarget Interface
+
+#if WITH_RIVE
+
+	public:
+
+		virtual const FRiveRenderCommandStream* GetAtlasEntryCommands() const override { return &SubmittedCommands; }
+
+	protected:
+
+		virtual rive::rcp<rive::pls::PLSRenderTarget> GetRenderTarget() const override;
+
+#endif // WITH_RIVE
+
+		//~ END : FRiveRenderTarget Interface
+
+		/**
+		 * Implementation(s)
+		 */
+
+#if WITH_RIVE
+
+	public:
+
+		/** Returns the rect of the entry, which clips its draws in the page. Created once, the size of an entry is fixed */
+		rive::RenderPath* GetEntryPath(FRiveRenderFactory& InRenderFactory);
+
+		/** Returns the paint filling the entry with its clear color, null while it is transparent. Only updated when the clear color changes */
+		rive::RenderPaint* GetClearPaint(FRiveRenderFactory& InRenderFactory);
+
+#endif // WITH_RIVE
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		FIntPoint Size;
+
+#if WITH_RIVE
+		/** Commands of the last submission, drawn by the atlas page until the next one */
+		FRiveRenderCommandStream SubmittedCommands;
+
+		rive::rcp<rive::RenderPath> EntryPath;
+
+		rive::rcp<rive::RenderPaint> ClearPaint;
+
+		FLinearColor ClearPaintColor = FLinearColor::Transparent;
+#endif // WITH_RIVE
+	};
+}
@@ -6,14 +6,30 @@
 #include "Engine/TextureRenderTarget2D.h"
 #include "Logs/RiveRendererLog.h"
 #include "RenderingThread.h"
+#include "RiveRenderFactory.h"
+#include "RiveRenderTargetAtlasEntry.h"
 #include "TextureResource.h"
 #include "UObject/Package.h"
 
+#include "rive/pls/pls_image.hpp"
 #include "rive/pls/pls_render_context.hpp"
+#include "rive/pls/pls_render_context_helper_impl.hpp"
+
+namespace UE::Rive::Renderer::Private
+{
+    /** Every PLS platform implementation can create a texture from RGBA pixels, but only decodeImageTexture reaches it from outside */
+    struct FPLSImageTextureAccess : rive::pls::PLSRenderContextHelperImpl
+    {
+        static auto GetMakeImageTexture() { return &FPLSImageTextureAccess::makeImageTexture; }
+    };
+}
 
 UE::Rive::Renderer::Private::FRiveRenderer::FRiveRenderer()
 {
     RIVE_DEBUG_FUNCTION_INDENT;
+#if WITH_RIVE
+    RenderFactory = std::make_unique<FRiveRenderFactory>(this);
+#endif // WITH_RIVE
 }
 
 UE::Rive::Renderer::Private::FRiveRenderer::~FRiveRenderer()
@@ -65,6 +81,64 @@ void UE::Rive::Renderer::Private::FRiveRenderer::QueueTextureRendering(TObjectPt
 {
 }
 
+void UE::Rive::Renderer::Private::FRiveRenderer::BeginRenderBatch_GameThread()
+{
+    check(IsInGameThread());
+    
+    ++RenderBatchDepth;
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderer::EndRenderBatch_GameThread()
+{
+    check(IsInGameThread());
+    
+    if (!ensure(RenderBatchDepth > 0) || --RenderBatchDepth > 0)
+    {
+        return;
+    }
+
+#if WITH_RIVE
+    // The images and fonts of the files released during the frame are freed here
+    RenderFactory->TrimDecodedAssets();
+#endif // WITH_RIVE
+
+    if (PendingRenderWork.IsEmpty())
+    {
+        return;
+    }
+
+    ENQUEUE_RENDER_COMMAND(RiveRenderBatch)(
+    [this, RenderWorks = MoveTemp(PendingRenderWork)](FRHICommandListImmediate& RHICmdList) mutable
+    {
+        BeginRenderBatch_RenderThread(RHICmdList);
+        bIsInRenderBatch_RenderThread = true;
+        for (FRenderWork& RenderWork : RenderWorks)
+        {
+            RenderWork(RHICmdList);
+        }
+        bIsInRenderBatch_RenderThread = false;
+        EndRenderBatch_RenderThread(RHICmdList);
+    });
+    PendingRenderWork.Reset();
+}
+
+void UE::Rive::Renderer::Private::FRiveRenderer::EnqueueRenderWork_GameThread(FRenderWork&& InRenderWork)
+{
+    check(IsInGameThread());
+    
+    if (RenderBatchDepth > 0)
+    {
+        PendingRenderWork.Add(MoveTemp(InRenderWork));
+        return;
+    }
+
+    ENQUEUE_RENDER_COMMAND(Render)(
+    [RenderWork = MoveTemp(InRenderWork)](FRHICommandListImmediate& RHICmdList) mutable
+    {
+        RenderWork(RHICmdList);
+    });
+}
+
 #if WITH_RIVE
 
 void UE::Rive::Renderer::Private::FRiveRenderer::CallOrRegister_OnInitialized(FOnRendererInitialized::FDelegate&& Delegate)
@@ -94,9 +168,33 @@ rive::pls::PLSRenderContext* UE::Rive::Renderer::Private::FRiveRenderer::GetPLSR
     return PLSRenderContext.get();
 }
 
+rive::Factory* UE::Rive::Renderer::Private::FRiveRenderer::GetFactory()
+{
+    return RenderFactory.get();
+}
+
+rive::rcp<rive::pls::PLSTexture> UE::Rive::Renderer::Private::FRiveRenderer::MakeImageTexture(uint32 InWidth, uint32 InHeight, uint32 InMipLevelCount, const uint8* InImageDataRGBA)
+{
+    rive::pls::PLSRenderContext* PLSRenderContextPtr = GetPLSRenderContextPtr();
+    if (!PLSRenderContextPtr)
+    {
+        return nullptr;
+    }
+
+    rive::pls::PLSRenderContextHelperImpl* PLSRenderContextImpl = PLSRenderContextPtr->static_impl_cast<rive::pls::PLSRenderContextHelperImpl>();
+    return (PLSRenderContextImpl->*FPLSImageTextureAccess::GetMakeImageTexture())(InWidth, InHeight, InMipLevelCount, InImageDataRGBA);
+}
+
 
 #endif // WITH_RIVE
 
+UE::Rive::Renderer::IRiveRenderTargetPtr UE::Rive::Renderer::Private::FRiveRenderer::CreateAtlasEntryTarget_GameThread(const FName& InRiveName, const FIntPoint& InSize)
+{
+    check(IsInGameThread());
+
+    return MakeShared<FRiveRenderTargetAtlasEntry>(SharedThis(this), InRiveName, InSize);
+}
+
 UTextureRenderTarget2D* UE::Rive::Renderer::Private::FRiveRenderer::CreateDefaultRenderTarget(FIntPoint InTargetSize)
 {
     UTextureRenderTarget2D* const RenderTarget = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
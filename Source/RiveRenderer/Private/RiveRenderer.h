@@ -9,16 +9,23 @@
 
 #if WITH_RIVE
 
+#include "RiveCore/Public/PreRiveHeaders.h"
+THIRD_PARTY_INCLUDES_START
+#include "rive/refcnt.hpp"
+THIRD_PARTY_INCLUDES_END
+
 namespace rive::pls
 {
     class PLSRenderer;
     class PLSRenderContext;
+    class PLSTexture;
 }
 
 #endif // WITH_RIVE
 
 namespace UE::Rive::Renderer::Private
 {
+    class FRiveRenderFactory;
     class FRiveRenderTarget;
     
     class FRiveRenderer : public IRiveRenderer
@@ -41,24 +48,96 @@ namespace UE::Rive::Renderer::Private
 
         virtual bool IsInitialized() const override { return InitializationState == ERiveInitState::Initialized; }
 
+        virtual bool IsRendering() const override { return true; }
+
         virtual void QueueTextureRendering(TObjectPtr<URiveFile> InRiveFile) override;
 
         virtual IRiveRenderTargetPtr CreateTextureTarget_GameThread(const FName& InRiveName, UTexture2DDynamic* InRenderTarget) override { return nullptr; }
 
+        virtual IRiveRenderTargetPtr CreateAtlasEntryTarget_GameThread(const FName& InRiveName, const FIntPoint& InSize) override;
+
         virtual UTextureRenderTarget2D* CreateDefaultRenderTarget(FIntPoint InTargetSize) override;
 
         virtual FCriticalSection& GetThreadDataCS() override { return ThreadDataCS; }
 
         virtual void CallOrRegister_OnInitialized(FOnRendererInitialized::FDelegate&& Delegate) override;
 
+        virtual void BeginRenderBatch_GameThread() override;
+
+        virtual void EndRenderBatch_GameThread() override;
+
 #if WITH_RIVE
 
         virtual rive::pls::PLSRenderContext* GetPLSRenderContextPtr() override;
 
+        virtual rive::Factory* GetFactory() override;
+
 #endif // WITH_RIVE
 
         //~ END : IRiveRenderer Interface
 
+        /**
+         * Implementation(s)
+         */
+
+    public:
+
+        using FRenderWork = TUniqueFunction<void(FRHICommandListImmediate&)>;
+
+        /** Enqueues the given work on the Render Thread, or holds it until the end of the current render batch */
+        void EnqueueRenderWork_GameThread(FRenderWork&& InRenderWork);
+
+        /** Returns true while the works of a render batch are executed, the platform state is then set up and restored once around all of them */
+        bool IsInRenderBatch_RenderThread() const { check(IsInRenderingThread()); return bIsInRenderBatch_RenderThread; }
+
+#if WITH_RIVE
+
+        /** Returns true if the PLSRenderContext can create GPU resources on the calling thread, FRiveRenderFactory defers the image textures otherwise */
+        virtual bool CanCreatePLSResources() const { return true; }
+
+        /** Creates the texture of an image decoded by FRiveRenderFactory, only called on a thread where CanCreatePLSResources, with the lock of the renderer */
+        virtual rive::rcp<rive::pls::PLSTexture> MakeImageTexture(uint32 InWidth, uint32 InHeight, uint32 InMipLevelCount, const uint8* InImageDataRGBA);
+
+        /** Drops the given reference to a PLS resource on a thread where the PLSRenderContext can delete it */
+        template <typename T>
+        void ReleasePLSResource(rive::rcp<T>&& InResource)
+        {
+            if (!InResource)
+            {
+                return;
+            }
+
+            if (CanCreatePLSResources())
+            {
+                InResource.reset();
+                return;
+            }
+
+            EnqueuePLSResourceRelease([Resource = std::move(InResource)]() mutable
+            {
+                Resource.reset();
+            });
+        }
+
+#endif // WITH_RIVE
+
+    protected:
+
+        /** Called on the Render Thread before the works of a render batch, to set up the platform state shared by all its targets */
+        virtual void BeginRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList) {}
+
+        /** Called on the Render Thread after the works of a render batch, to restore the state of the RHI */
+        virtual void EndRenderBatch_RenderThread(FRHICommandListImmediate& RHICmdList) {}
+
+#if WITH_RIVE
+
+        /** Runs the given release on a thread where CanCreatePLSResources is true */
+        virtual void EnqueuePLSResourceRelease(TUniqueFunction<void()>&& InRelease) { InRelease(); }
+
+        FRiveRenderFactory* GetRenderFactory() const { return RenderFactory.get(); }
+
+#endif // WITH_RIVE
+
         /**
          * Attribute(s)
          */
@@ -69,6 +148,8 @@ namespace UE::Rive::Renderer::Private
 
         std::unique_ptr<rive::pls::PLSRenderContext> PLSRenderContext;
 
+        std::unique_ptr<FRiveRenderFactory> RenderFactory;
+
 #endif // WITH_RIVE
 
         TMap<FName, TSharedPtr<FRiveRenderTarget>> RenderTargets;
@@ -77,6 +158,14 @@ namespace UE::Rive::Renderer::Private
 
         mutable FCriticalSection ThreadDataCS;
 
+    private:
+
+        int32 RenderBatchDepth = 0;
+
+        TArray<FRenderWork> PendingRenderWork;
+
+        bool bIsInRenderBatch_RenderThread = false;
+
     protected:
         ERiveInitState InitializationState = ERiveInitState::Uninitialized;
         FOnRendererInitialized OnInitializedDelegate;
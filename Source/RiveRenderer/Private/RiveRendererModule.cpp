@@ -3,6 +3,7 @@
 #include "RiveRendererModule.h"
 #include "RiveRenderer.h"
 #include "Logs/RiveRendererLog.h"
+#include "Platform/RiveRendererNull.h"
 
 #if PLATFORM_WINDOWS
 #include "Platform/RiveRendererD3D11.h"
@@ -18,11 +19,21 @@ void UE::Rive::Renderer::Private::FRiveRendererModule::StartupModule()
 {
     RIVE_DEBUG_FUNCTION_INDENT;
     
-    check(GDynamicRHI);
+    // Without a GPU to render with, the Null Renderer still lets the Rive Files be imported and their Artboards advanced.
+    // The bundled Rive renderer has no backend for the other platforms (Linux), which always use it
+    constexpr bool bHasRendererBackend = PLATFORM_WINDOWS || PLATFORM_APPLE || PLATFORM_ANDROID;
+    const bool bIsHeadless = !bHasRendererBackend || !GDynamicRHI || GUsingNullRHI || IsRunningDedicatedServer() || IsRunningCommandlet();
+    
     // Create Platform Specific Renderer
     RiveRenderer = nullptr;
-    switch (RHIGetInterfaceType())
+    switch (bIsHeadless ? ERHIInterfaceType::Null : RHIGetInterfaceType())
     {
+    case ERHIInterfaceType::Null:
+        {
+            UE_LOG(LogRiveRenderer, Display, TEXT("Rive running without rendering (Null Renderer)"))
+            RiveRenderer = MakeShared<FRiveRendererNull>();
+            break;
+        }
 #if PLATFORM_WINDOWS
     case ERHIInterfaceType::D3D11:
         {
@@ -59,14 +70,12 @@ void UE::Rive::Renderer::Private::FRiveRendererModule::StartupModule()
 #endif // PLATFORM_APPLE
     case ERHIInterfaceType::Vulkan:
         {
-            UE_LOG(LogRiveRenderer, Error, TEXT("Rive is NOT compatible with RHI 'Vulkan'"))
+            // The PLS runtime bundled in RiveLibrary has no Vulkan implementation (only D3D11, Metal, OpenGL and WebGPU)
+            UE_LOG(LogRiveRenderer, Error, TEXT("Rive is NOT compatible with RHI 'Vulkan', the bundled Rive renderer has no Vulkan backend"))
             break;
         }
     default:
-        if(!IsRunningCommandlet())
-        {
-            UE_LOG(LogRiveRenderer, Error, TEXT("Rive is NOT compatible with the current unknown RHI"))
-        }
+        UE_LOG(LogRiveRenderer, Error, TEXT("Rive is NOT compatible with the current unknown RHI"))
         break;
     }
     
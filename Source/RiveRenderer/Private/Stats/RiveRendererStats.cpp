@@ -1,3 +1,9 @@
 // Copyright Rive, Inc. All rights reserved.
 
 #include "RiveRendererStats.h"
+
+DEFINE_STAT(STAT_RiveRendererLockWait);
+DEFINE_STAT(STAT_RiveRendererArtboardLockWait);
+DEFINE_STAT(STAT_RiveRendererRecordSnapshot);
+DEFINE_STAT(STAT_RiveRendererCommandBufferAllocations);
+DEFINE_STAT(STAT_RiveRendererDrawSnapshotAllocations);
@@ -5,3 +5,18 @@
 #include "Stats/Stats2.h"
 
 DECLARE_STATS_GROUP(TEXT("RiveRenderer"), STATGROUP_RiveRenderer, STATCAT_Advanced);
+
+/** Time spent waiting on the renderer-wide lock guarding the PLSRenderContext */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Renderer Lock Wait"), STAT_RiveRendererLockWait, STATGROUP_RiveRenderer, );
+
+/** Time spent by the Game Thread waiting on an Artboard lock before recording its draw snapshot */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Artboard Lock Wait (Record)"), STAT_RiveRendererArtboardLockWait, STATGROUP_RiveRenderer, );
+
+/** Time spent by the Game Thread recording the draw snapshots of the Artboards */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Record Draw Snapshot"), STAT_RiveRendererRecordSnapshot, STATGROUP_RiveRenderer, );
+
+/** Command streams allocated this frame because all the pooled ones were in flight, it drops to zero once the pools are warm */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Command Buffer Allocations"), STAT_RiveRendererCommandBufferAllocations, STATGROUP_RiveRenderer, );
+
+/** Draw snapshots allocated this frame because all the pooled ones were in flight, it drops to zero once the pools are warm */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Draw Snapshot Allocations"), STAT_RiveRendererDrawSnapshotAllocations, STATGROUP_RiveRenderer, );
@@ -17,6 +17,8 @@ THIRD_PARTY_INCLUDES_END
 namespace rive
 {
 	class Artboard;
+	class RenderPaint;
+	class RenderPath;
 	class Renderer;
 
 	namespace pls
@@ -67,11 +69,27 @@ namespace UE::Rive::Renderer
 		virtual void Restore() = 0;
 		virtual void Transform(float X1, float Y1, float X2, float Y2, float TX, float TY) = 0;
 		virtual void Translate(const FVector2f& InVector) = 0;
-		virtual void Draw(rive::Artboard* InArtboard) = 0;
+		/**
+		 * Records the draws of the given Artboard into an immutable snapshot and queues its drawing, the Render Thread never reads the Artboard itself
+		 * @param InArtboardCS Lock guarding the Artboard instance, held on the Game Thread while recording
+		 */
+		virtual void Draw(rive::Artboard* InArtboard, FCriticalSection* InArtboardCS) = 0;
+		/**
+		 * Queues the drawing of a path with the current transform, in the same PLS frame as the Artboards drawn on this target.
+		 * The path and paint are created with IRiveRenderer::GetFactory, their current state is copied so they can be modified again right away.
+		 */
+		virtual void DrawPath(rive::RenderPath* InPath, rive::RenderPaint* InPaint) = 0;
+		/** Queues a clip of the next draws to the path, it lasts until the enclosing Save is restored */
+		virtual void ClipPath(rive::RenderPath* InPath) = 0;
 		virtual void Align(const FBox2f& InBox, ERiveFitType InFit, const FVector2f& InAlignment, rive::Artboard* InArtboard) = 0;
 		virtual void Align(ERiveFitType InFit, const FVector2f& InAlignment, rive::Artboard* InArtboard) = 0;
 		/** Returns the transformation Matrix from the start of the Render Queue up to now */
 		virtual FMatrix GetTransformMatrix() const = 0;
+		/**
+		 * Queues the drawing of the last submission of an atlas entry target (see IRiveRenderer::CreateAtlasEntryTarget_GameThread) at the given offset,
+		 * clipped to the entry size and cleared with its clear color
+		 */
+		virtual void DrawAtlasEntry(const IRiveRenderTargetRef& InEntryTarget, const FIntPoint& InOffset) = 0;
 
 #endif // WITH_RIVE
 
@@ -80,5 +98,7 @@ namespace UE::Rive::Renderer
 		virtual void SetClearColor(const FLinearColor& InColor) = 0;
 		virtual uint32 GetWidth() const = 0;
 		virtual uint32 GetHeight() const = 0;
+		/** Returns true if nothing was submitted yet, or if the size or the clear color changed since the last submission */
+		virtual bool NeedsRedraw() const = 0;
 	};
 }
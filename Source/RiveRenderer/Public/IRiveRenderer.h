@@ -14,6 +14,7 @@ class UTextureRenderTarget2D;
 namespace rive
 {
     class Artboard;
+    class Factory;
 
     namespace pls
     {
@@ -58,23 +59,50 @@ namespace UE::Rive::Renderer
         virtual void Initialize() = 0;
 
         virtual bool IsInitialized() const = 0;
+
+        /** False when the draws are dropped (Null Renderer), the Rive Files then need no texture to be drawn into */
+        virtual bool IsRendering() const = 0;
         
         virtual void QueueTextureRendering(TObjectPtr<URiveFile> InRiveFile) = 0;
 
         virtual IRiveRenderTargetPtr CreateTextureTarget_GameThread(const FName& InRiveName, UTexture2DDynamic* InRenderTarget) = 0;
+
+        /**
+         * Creates a Render Target of the given size without texture, its submissions are drawn into a texture atlas page with IRiveRenderTarget::DrawAtlasEntry.
+         * Unlike the texture targets, it is owned by the caller only
+         */
+        virtual IRiveRenderTargetPtr CreateAtlasEntryTarget_GameThread(const FName& InRiveName, const FIntPoint& InSize) = 0;
         
         virtual void CreatePLSContext_RenderThread(FRHICommandListImmediate& RHICmdList) = 0;
 
         virtual UTextureRenderTarget2D* CreateDefaultRenderTarget(FIntPoint InTargetSize) = 0;
 
+        /**
+         * Lock guarding the PLSRenderContext lifetime and its use (factory, frames). Artboards are guarded by their own lock,
+         * which must only be taken after this one when both are needed
+         */
         virtual FCriticalSection& GetThreadDataCS() = 0;
 
         virtual void CallOrRegister_OnInitialized(FOnRendererInitialized::FDelegate&& Delegate) = 0;
+
+        /**
+         * Starts collecting the submissions of all the Render Targets, they are then sent to the Render Thread as a single render command by the matching EndRenderBatch_GameThread.
+         * Batches can be nested, only the outermost one enqueues the work.
+         */
+        virtual void BeginRenderBatch_GameThread() = 0;
+
+        virtual void EndRenderBatch_GameThread() = 0;
     
 #if WITH_RIVE
 
         virtual rive::pls::PLSRenderContext* GetPLSRenderContextPtr() = 0;
 
+        /**
+         * Factory to import the Rive Files with. The Paths and Paints it creates are snapshotted when their Artboard is drawn,
+         * so the Render Thread never reads an Artboard which the Game Thread may be advancing
+         */
+        virtual rive::Factory* GetFactory() = 0;
+
 #endif // WITH_RIVE
     };
 }
@@ -45,14 +45,7 @@ namespace UE::Rive::Renderer
 		/**
 		 * Attribute(s)
 		 */
-		// TODO. REMOVE IT!! Temporary switches for Android testng
-		static bool RunInGameThread()
-        {
-#if PLATFORM_ANDROID
-            return true;
-#endif // PLATFORM_ANDROID
-            return false;
-        }
+
 	private:
 
 		static constexpr const TCHAR* ModuleName = TEXT("RiveRenderer");
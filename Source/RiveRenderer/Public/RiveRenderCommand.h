@@ -28,6 +28,9 @@ enum class ERiveRenderCommandType : uint8
 	Translate
 };
 
+/**
+ * Blueprint-facing description of a render command. Render targets do not store these, they record a packed FRiveRenderCommandStream.
+ */
 USTRUCT(BlueprintType)
 struct FRiveRenderCommand
 {
@@ -56,6 +59,9 @@ public:
 	// UPROPERTY(BlueprintReadWrite)
 	rive::Artboard* NativeArtboard = nullptr;
 
+	/** Bounds of NativeArtboard, used by AlignArtboard */
+	FBox2f ArtboardBounds = FBox2f(ForceInit);
+
 	UPROPERTY(BlueprintReadWrite, Category=Rive)
 	float X;
 
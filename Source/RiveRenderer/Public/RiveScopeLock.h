@@ -0,0 +1,50 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+namespace UE::Rive::Renderer
+{
+	/**
+	 * Scope lock which records the time spent waiting on the given critical section into a cycle stat.
+	 * A null critical section is allowed and results in a no-op lock, i.e. for objects which were never bound to an owner.
+	 */
+	class FRiveScopeLock
+	{
+		/**
+		 * Structor(s)
+		 */
+
+	public:
+
+		UE_NODISCARD_CTOR FRiveScopeLock(FCriticalSection* InSyncObject, TStatId InWaitStatId)
+			: SyncObject(InSyncObject)
+		{
+			if (SyncObject)
+			{
+				FScopeCycleCounter WaitCycleCounter(InWaitStatId);
+				SyncObject->Lock();
+			}
+		}
+
+		~FRiveScopeLock()
+		{
+			if (SyncObject)
+			{
+				SyncObject->Unlock();
+			}
+		}
+
+		UE_NONCOPYABLE(FRiveScopeLock);
+
+		/**
+		 * Attribute(s)
+		 */
+
+	private:
+
+		FCriticalSection* SyncObject;
+	};
+}
@@ -40,6 +40,18 @@ enum class ERiveAlignment : uint8
 	BottomRight = 8,
 };
 
+/** How often a Rive File or Rive Actor Component is advanced and redrawn, each update receiving the time elapsed since the previous one */
+UENUM(BlueprintType)
+enum class ERiveUpdateRate : uint8
+{
+	EveryFrame = 0 UMETA(DisplayName = "Every Frame"),
+	Hz60 UMETA(DisplayName = "60 Hz"),
+	Hz30 UMETA(DisplayName = "30 Hz"),
+	Hz15 UMETA(DisplayName = "15 Hz"),
+	/** Only updated while its State Machine is running or has pending inputs, or after a redraw request */
+	OnDemand UMETA(DisplayName = "On Demand"),
+};
+
 UENUM(BlueprintType)
 enum class ERiveBlendMode : uint8
 {
@@ -143,10 +143,29 @@ public class RiveLibrary : ModuleRules
         else if (Target.IsInPlatformGroup(UnrealPlatformGroup.Unix))
         {
             string LibDirectory = Path.Combine(RootDir, "Libraries", "Unix");
+            string RiveSheenBidiStaticLibName = "librive_sheenbidi" + LibPostfix + ".a";
+            string RiveHarfBuzzStaticLibName = "librive_harfbuzz" + LibPostfix + ".a";
+            string RiveStaticLibName = "librive" + LibPostfix + ".a";
+            string RiveDecodersStaticLibName = "librive_decoders" + LibPostfix + ".a";
+            string RivePlsLibName = "librive_pls_renderer" + LibPostfix + ".a";
+            string RivePngLibName = "liblibpng" + LibPostfix + ".a";
 
-            // NOTE : Link Unix Libraries
-
-            bIsPlatformAdded = true;
+            // The Unix libraries are not shipped yet, compiling with WITH_RIVE=1 without them would fail to link
+            if (File.Exists(Path.Combine(LibDirectory, RiveStaticLibName)))
+            {
+                PublicAdditionalLibraries.AddRange(new string[]
+                    {
+                        Path.Combine(LibDirectory, RiveSheenBidiStaticLibName)
+                        , Path.Combine(LibDirectory, RiveHarfBuzzStaticLibName)
+                        , Path.Combine(LibDirectory, RiveStaticLibName)
+                        , Path.Combine(LibDirectory, RiveDecodersStaticLibName)
+                        , Path.Combine(LibDirectory, RivePlsLibName)
+                        , Path.Combine(LibDirectory, RivePngLibName)
+                    }
+                );
+
+                bIsPlatformAdded = true;
+            }
         }
 
         PublicDefinitions.Add("WITH_RIVE=" + (bIsPlatformAdded ? "1" : "0"));